@@ -57,6 +57,14 @@ float Engine::get_physics_jitter_fix() const {
 	return physics_jitter_fix;
 }
 
+void Engine::set_physics_interpolation_enabled(bool p_enabled) {
+	physics_interpolation = p_enabled;
+}
+
+bool Engine::is_physics_interpolation_enabled() const {
+	return physics_interpolation;
+}
+
 void Engine::set_target_fps(int p_fps) {
 	_target_fps = p_fps > 0 ? p_fps : 0;
 }
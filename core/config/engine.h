@@ -54,6 +54,7 @@ private:
 
 	int ips = 60;
 	float physics_jitter_fix = 0.5;
+	bool physics_interpolation = false;
 	float _fps = 1;
 	int _target_fps = 0;
 	float _time_scale = 1.0;
@@ -83,6 +84,9 @@ public:
 	void set_physics_jitter_fix(float p_threshold);
 	float get_physics_jitter_fix() const;
 
+	void set_physics_interpolation_enabled(bool p_enabled);
+	bool is_physics_interpolation_enabled() const;
+
 	virtual void set_target_fps(int p_fps);
 	virtual int get_target_fps() const;
 
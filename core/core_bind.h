@@ -629,6 +629,8 @@ public:
 
 	void set_physics_jitter_fix(float p_threshold);
 	float get_physics_jitter_fix() const;
+	void set_physics_interpolation_enabled(bool p_enabled);
+	bool is_physics_interpolation_enabled() const;
 	float get_physics_interpolation_fraction() const;
 
 	void set_target_fps(int p_fps);
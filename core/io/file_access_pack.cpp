@@ -73,13 +73,16 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 		if (p.find("/") != -1) { //in a subdir
 
 			Vector<String> ds = p.get_base_dir().split("/");
+			String dir_path = "res://";
 
 			for (int j = 0; j < ds.size(); j++) {
+				dir_path = dir_path.plus_file(ds[j]);
 				if (!cd->subdirs.has(ds[j])) {
 					PackedDir *pd = memnew(PackedDir);
 					pd->name = ds[j];
 					pd->parent = cd;
 					cd->subdirs[pd->name] = pd;
+					directories.set(PathMD5(dir_path.md5_buffer()), pd);
 					cd = pd;
 				} else {
 					cd = cd->subdirs[ds[j]];
@@ -105,6 +108,7 @@ PackedData *PackedData::singleton = nullptr;
 PackedData::PackedData() {
 	singleton = this;
 	root = memnew(PackedDir);
+	directories.set(PathMD5(String("res://").md5_buffer()), root);
 
 	add_pack_source(memnew(PackedSourcePCK));
 }
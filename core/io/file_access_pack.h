@@ -34,6 +34,7 @@
 #include "core/os/dir_access.h"
 #include "core/os/file_access.h"
 #include "core/string/print_string.h"
+#include "core/templates/hash_map.h"
 #include "core/templates/list.h"
 #include "core/templates/map.h"
 #include "core/templates/set.h"
@@ -91,6 +92,11 @@ private:
 			return a == p_md5.a && b == p_md5.b;
 		}
 
+		// The key is already an MD5 digest, so any part of it is a good hash.
+		static _FORCE_INLINE_ uint32_t hash(const PathMD5 &p_md5) {
+			return uint32_t(p_md5.a);
+		}
+
 		PathMD5() {}
 
 		PathMD5(const Vector<uint8_t> &p_buf) {
@@ -99,7 +105,9 @@ private:
 		}
 	};
 
-	Map<PathMD5, PackedFile> files;
+	HashMap<PathMD5, PackedFile, PathMD5> files;
+	// Absolute paths of all directories, so lookups don't have to walk the tree.
+	HashMap<PathMD5, PackedDir *, PathMD5> directories;
 
 	Vector<PackSource *> sources;
 
@@ -188,15 +196,15 @@ public:
 
 FileAccess *PackedData::try_open_path(const String &p_path) {
 	PathMD5 pmd5(p_path.md5_buffer());
-	Map<PathMD5, PackedFile>::Element *E = files.find(pmd5);
-	if (!E) {
+	PackedFile *pf = files.getptr(pmd5);
+	if (!pf) {
 		return nullptr; //not found
 	}
-	if (E->get().offset == 0) {
+	if (pf->offset == 0) {
 		return nullptr; //was erased
 	}
 
-	return E->get().src->get_file(p_path, &E->get());
+	return pf->src->get_file(p_path, pf);
 }
 
 bool PackedData::has_path(const String &p_path) {
@@ -204,6 +212,10 @@ bool PackedData::has_path(const String &p_path) {
 }
 
 bool PackedData::has_directory(const String &p_path) {
+	if (p_path.begins_with("res://") && p_path.find("..") == -1) {
+		return directories.has(PathMD5(p_path.simplify_path().md5_buffer()));
+	}
+
 	DirAccess *da = try_open_directory(p_path);
 	if (da) {
 		memdelete(da);
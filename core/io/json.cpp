@@ -30,7 +30,9 @@
 
 #include "json.h"
 
+#include "core/os/file_access.h"
 #include "core/string/print_string.h"
+#include "core/templates/local_vector.h"
 
 const char *JSON::tk_name[TK_MAX] = {
 	"'{'",
@@ -45,84 +47,189 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
-static String _make_indent(const String &p_indent, int p_size) {
-	String indent_text = "";
-	if (!p_indent.is_empty()) {
-		for (int i = 0; i < p_size; i++) {
-			indent_text += p_indent;
+// Flush the text pending in a file backed writer once it grows past this many characters.
+#define JSON_WRITER_FLUSH_SIZE 65536
+
+// All the text goes through these, so a file backed writer never holds much more than the flush size.
+void JSON::Writer::_write(const String &p_string) {
+	buffer += p_string;
+	if (file && buffer.length() >= JSON_WRITER_FLUSH_SIZE) {
+		flush();
+	}
+}
+
+void JSON::Writer::_write(const char *p_literal) {
+	buffer += p_literal;
+	if (file && buffer.length() >= JSON_WRITER_FLUSH_SIZE) {
+		flush();
+	}
+}
+
+void JSON::Writer::_write_indent(int p_level) {
+	if (indent.is_empty()) {
+		return;
+	}
+	for (int i = 0; i < p_level; i++) {
+		_write(indent);
+	}
+}
+
+void JSON::Writer::_write_separator() {
+	if (levels[levels.size() - 1].count > 0) {
+		_write(",");
+		if (!indent.is_empty()) {
+			_write("\n");
 		}
 	}
-	return indent_text;
+	levels.write[levels.size() - 1].count++;
+	_write_indent(levels.size());
 }
 
-String JSON::_print_var(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys) {
-	String colon = ":";
-	String end_statement = "";
+void JSON::Writer::_begin_value() {
+	// Values inside objects follow their key, which already wrote the separator.
+	if (levels.size() > 0 && !levels[levels.size() - 1].is_object) {
+		_write_separator();
+	}
+}
 
-	if (!p_indent.is_empty()) {
-		colon += " ";
-		end_statement += "\n";
+Error JSON::Writer::begin_object() {
+	_begin_value();
+	_write(indent.is_empty() ? "{" : "{\n");
+	Level level;
+	level.is_object = true;
+	levels.push_back(level);
+	return OK;
+}
+
+Error JSON::Writer::end_object() {
+	ERR_FAIL_COND_V(levels.size() == 0 || !levels[levels.size() - 1].is_object, ERR_INVALID_DATA);
+	levels.resize(levels.size() - 1);
+	if (!indent.is_empty()) {
+		_write("\n");
+	}
+	_write_indent(levels.size());
+	_write("}");
+	return OK;
+}
+
+Error JSON::Writer::begin_array() {
+	_begin_value();
+	_write(indent.is_empty() ? "[" : "[\n");
+	levels.push_back(Level());
+	return OK;
+}
+
+Error JSON::Writer::end_array() {
+	ERR_FAIL_COND_V(levels.size() == 0 || levels[levels.size() - 1].is_object, ERR_INVALID_DATA);
+	levels.resize(levels.size() - 1);
+	if (!indent.is_empty()) {
+		_write("\n");
 	}
+	_write_indent(levels.size());
+	_write("]");
+	return OK;
+}
 
-	switch (p_var.get_type()) {
-		case Variant::NIL:
-			return "null";
-		case Variant::BOOL:
-			return p_var.operator bool() ? "true" : "false";
-		case Variant::INT:
-			return itos(p_var);
-		case Variant::FLOAT:
-			return rtos(p_var);
+Error JSON::Writer::key(const String &p_key) {
+	ERR_FAIL_COND_V(levels.size() == 0 || !levels[levels.size() - 1].is_object, ERR_INVALID_DATA);
+	_write_separator();
+	_write("\"");
+	_write(p_key.json_escape());
+	_write(indent.is_empty() ? "\":" : "\": ");
+	return OK;
+}
+
+Error JSON::Writer::value(const Variant &p_value) {
+	switch (p_value.get_type()) {
+		case Variant::NIL: {
+			_begin_value();
+			_write("null");
+		} break;
+		case Variant::BOOL: {
+			_begin_value();
+			_write(p_value.operator bool() ? "true" : "false");
+		} break;
+		case Variant::INT: {
+			_begin_value();
+			_write(itos(p_value));
+		} break;
+		case Variant::FLOAT: {
+			_begin_value();
+			_write(rtos(p_value));
+		} break;
 		case Variant::PACKED_INT32_ARRAY:
 		case Variant::PACKED_INT64_ARRAY:
 		case Variant::PACKED_FLOAT32_ARRAY:
 		case Variant::PACKED_FLOAT64_ARRAY:
 		case Variant::PACKED_STRING_ARRAY:
 		case Variant::ARRAY: {
-			String s = "[";
-			s += end_statement;
-			Array a = p_var;
+			begin_array();
+			Array a = p_value;
 			for (int i = 0; i < a.size(); i++) {
-				if (i > 0) {
-					s += ",";
-					s += end_statement;
-				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _print_var(a[i], p_indent, p_cur_indent + 1, p_sort_keys);
+				value(a[i]);
 			}
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "]";
-			return s;
-		}
+			end_array();
+		} break;
 		case Variant::DICTIONARY: {
-			String s = "{";
-			s += end_statement;
-			Dictionary d = p_var;
+			begin_object();
+			Dictionary d = p_value;
 			List<Variant> keys;
 			d.get_key_list(&keys);
 
-			if (p_sort_keys) {
+			if (sort_keys) {
 				keys.sort();
 			}
 
 			for (List<Variant>::Element *E = keys.front(); E; E = E->next()) {
-				if (E != keys.front()) {
-					s += ",";
-					s += end_statement;
-				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _print_var(String(E->get()), p_indent, p_cur_indent + 1, p_sort_keys);
-				s += colon;
-				s += _print_var(d[E->get()], p_indent, p_cur_indent + 1, p_sort_keys);
+				key(String(E->get()));
+				value(d[E->get()]);
 			}
+			end_object();
+		} break;
+		default: {
+			_begin_value();
+			_write("\"");
+			_write(String(p_value).json_escape());
+			_write("\"");
+		} break;
+	}
 
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "}";
-			return s;
-		}
-		default:
-			return "\"" + String(p_var).json_escape() + "\"";
+	return OK;
+}
+
+Error JSON::Writer::flush() {
+	if (!file) {
+		return OK;
+	}
+	if (!buffer.is_empty()) {
+		file->store_string(buffer);
+		buffer = String();
 	}
+	return file->get_error();
+}
+
+String JSON::Writer::get_string() const {
+	return buffer;
+}
+
+JSON::Writer::Writer(const String &p_indent, bool p_sort_keys, FileAccess *p_file) {
+	indent = p_indent;
+	sort_keys = p_sort_keys;
+	file = p_file;
 }
 
 String JSON::print(const Variant &p_var, const String &p_indent, bool p_sort_keys) {
-	return _print_var(p_var, p_indent, 0, p_sort_keys);
+	Writer writer(p_indent, p_sort_keys);
+	writer.value(p_var);
+	return writer.get_string();
+}
+
+Error JSON::print_to_file(FileAccess *p_file, const Variant &p_var, const String &p_indent, bool p_sort_keys) {
+	ERR_FAIL_NULL_V(p_file, ERR_INVALID_PARAMETER);
+
+	Writer writer(p_indent, p_sort_keys, p_file);
+	writer.value(p_var);
+	return writer.flush();
 }
 
 Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
@@ -510,6 +617,618 @@ Error JSON::parse(const String &p_json, Variant &r_ret, String &r_err_str, int &
 	return err;
 }
 
+// Event driven parser reading UTF-8 either from memory or, in chunks, from a file.
+// Nesting is tracked with an explicit stack, so deep documents can't overflow the call stack.
+class JSONStreamParser {
+	enum {
+		FILE_BUFFER_SIZE = 65536,
+		END = -1,
+	};
+
+	enum State {
+		STATE_VALUE,
+		STATE_ARRAY_FIRST,
+		STATE_OBJECT_KEY,
+		STATE_AFTER_VALUE,
+	};
+
+	FileAccess *file = nullptr;
+	Vector<uint8_t> file_buffer;
+	const uint8_t *data = nullptr;
+	int data_len = 0;
+	int pos = 0;
+
+	LocalVector<char> token;
+
+	bool _refill() {
+		if (!file) {
+			return false;
+		}
+		data_len = file->get_buffer(file_buffer.ptrw(), FILE_BUFFER_SIZE);
+		pos = 0;
+		return data_len > 0;
+	}
+
+	_FORCE_INLINE_ int _peek() {
+		if (pos == data_len && !_refill()) {
+			return END;
+		}
+		// NUL terminates the text, like in JSON::parse().
+		return data[pos] ? data[pos] : (int)END;
+	}
+
+	_FORCE_INLINE_ void _advance() {
+		pos++;
+	}
+
+	int _skip_whitespace() {
+		while (true) {
+			int c = _peek();
+			if (c == END || c > 32) {
+				return c;
+			}
+			if (c == '\n') {
+				line++;
+			}
+			_advance();
+		}
+	}
+
+	void _append_utf8(char32_t p_char) {
+		if (p_char <= 0x7f) {
+			token.push_back(p_char);
+		} else if (p_char <= 0x7ff) {
+			token.push_back(0xc0 | ((p_char >> 6) & 0x1f));
+			token.push_back(0x80 | (p_char & 0x3f));
+		} else if (p_char <= 0xffff) {
+			token.push_back(0xe0 | ((p_char >> 12) & 0x0f));
+			token.push_back(0x80 | ((p_char >> 6) & 0x3f));
+			token.push_back(0x80 | (p_char & 0x3f));
+		} else {
+			token.push_back(0xf0 | ((p_char >> 18) & 0x07));
+			token.push_back(0x80 | ((p_char >> 12) & 0x3f));
+			token.push_back(0x80 | ((p_char >> 6) & 0x3f));
+			token.push_back(0x80 | (p_char & 0x3f));
+		}
+	}
+
+	Error _parse_hex(char32_t &r_value) {
+		r_value = 0;
+		for (int j = 0; j < 4; j++) {
+			int c = _peek();
+			if (c == END) {
+				err_str = "Unterminated String";
+				return ERR_PARSE_ERROR;
+			}
+			char32_t v;
+			if (c >= '0' && c <= '9') {
+				v = c - '0';
+			} else if (c >= 'a' && c <= 'f') {
+				v = c - 'a' + 10;
+			} else if (c >= 'A' && c <= 'F') {
+				v = c - 'A' + 10;
+			} else {
+				err_str = "Malformed hex constant in string";
+				return ERR_PARSE_ERROR;
+			}
+			r_value = (r_value << 4) | v;
+			_advance();
+		}
+		return OK;
+	}
+
+	// Decodes the UTF-8 collected so far and appends it to the string.
+	Error _flush_token(String &r_string) {
+		if (token.size() == 0) {
+			return OK;
+		}
+		String run;
+		if (run.parse_utf8(token.ptr(), token.size())) {
+			err_str = "Invalid UTF-8 in string";
+			return ERR_PARSE_ERROR;
+		}
+		r_string += run;
+		token.clear();
+		return OK;
+	}
+
+	// Expects the opening quote to be consumed already.
+	Error _parse_string(String &r_string) {
+		r_string = String();
+		token.clear();
+		while (true) {
+			int c = _peek();
+			if (c == END) {
+				err_str = "Unterminated String";
+				return ERR_PARSE_ERROR;
+			}
+			_advance();
+
+			if (c == '"') {
+				break;
+			} else if (c == '\\') {
+				int next = _peek();
+				if (next == END) {
+					err_str = "Unterminated String";
+					return ERR_PARSE_ERROR;
+				}
+				_advance();
+
+				switch (next) {
+					case 'b':
+						token.push_back(8);
+						break;
+					case 't':
+						token.push_back(9);
+						break;
+					case 'n':
+						token.push_back(10);
+						break;
+					case 'f':
+						token.push_back(12);
+						break;
+					case 'r':
+						token.push_back(13);
+						break;
+					case 'u': {
+						char32_t res;
+						Error err = _parse_hex(res);
+						if (err) {
+							return err;
+						}
+						if ((res & 0xfffffc00) == 0xd800) {
+							if (_peek() != '\\') {
+								err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
+								return ERR_PARSE_ERROR;
+							}
+							_advance();
+							if (_peek() != 'u') {
+								err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
+								return ERR_PARSE_ERROR;
+							}
+							_advance();
+							char32_t trail;
+							err = _parse_hex(trail);
+							if (err) {
+								return err;
+							}
+							if ((trail & 0xfffffc00) != 0xdc00) {
+								err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
+								return ERR_PARSE_ERROR;
+							}
+							res = (res << 10UL) + trail - ((0xd800 << 10UL) + 0xdc00 - 0x10000);
+						} else if ((res & 0xfffffc00) == 0xdc00) {
+							err_str = "Invalid UTF-16 sequence in string, unpaired trail surrogate";
+							return ERR_PARSE_ERROR;
+						}
+						if (res == 0) {
+							// parse_utf8() stops at NUL, so it's appended between the decoded runs.
+							err = _flush_token(r_string);
+							if (err) {
+								return err;
+							}
+							r_string += char32_t(0);
+						} else {
+							_append_utf8(res);
+						}
+					} break;
+					default: {
+						token.push_back(next);
+					} break;
+				}
+			} else {
+				if (c == '\n') {
+					line++;
+				}
+				token.push_back(c);
+			}
+		}
+
+		return _flush_token(r_string);
+	}
+
+	Error _parse_number(double &r_number) {
+		token.clear();
+		while (true) {
+			int c = _peek();
+			if (!((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')) {
+				break;
+			}
+			token.push_back(c);
+			_advance();
+		}
+		token.push_back(0);
+
+		if (!JSON::_parse_number(token.ptr(), token.size() - 1, r_number)) {
+			err_str = "Malformed number";
+			return ERR_PARSE_ERROR;
+		}
+		return OK;
+	}
+
+	Error _parse_literal(Variant &r_value) {
+		token.clear();
+		while (true) {
+			int c = _peek();
+			if (!((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'))) {
+				break;
+			}
+			token.push_back(c);
+			_advance();
+		}
+		token.push_back(0);
+
+		const char *id = token.ptr();
+		if (strcmp(id, "true") == 0) {
+			r_value = true;
+		} else if (strcmp(id, "false") == 0) {
+			r_value = false;
+		} else if (strcmp(id, "null") == 0) {
+			r_value = Variant();
+		} else {
+			err_str = "Expected 'true','false' or 'null', got '" + String(id) + "'.";
+			return ERR_PARSE_ERROR;
+		}
+		return OK;
+	}
+
+public:
+	String err_str;
+	int line = 0;
+
+	Error parse(JSON::Handler *p_handler) {
+		// Skip the UTF-8 BOM, if any.
+		if (_peek() == 0xef) {
+			_advance();
+			if (_peek() != 0xbb) {
+				err_str = "Unexpected character.";
+				return ERR_PARSE_ERROR;
+			}
+			_advance();
+			if (_peek() != 0xbf) {
+				err_str = "Unexpected character.";
+				return ERR_PARSE_ERROR;
+			}
+			_advance();
+		}
+
+		LocalVector<bool> is_object_stack;
+		State state = STATE_VALUE;
+		String str;
+		Variant value;
+
+		while (true) {
+			switch (state) {
+				case STATE_VALUE: {
+					int c = _skip_whitespace();
+					Error err = OK;
+					if (c == '{') {
+						_advance();
+						err = p_handler->begin_object();
+						is_object_stack.push_back(true);
+						state = STATE_OBJECT_KEY;
+					} else if (c == '[') {
+						_advance();
+						err = p_handler->begin_array();
+						is_object_stack.push_back(false);
+						state = STATE_ARRAY_FIRST;
+					} else if (c == '"') {
+						_advance();
+						err = _parse_string(str);
+						if (err == OK) {
+							err = p_handler->value(str);
+						}
+						state = STATE_AFTER_VALUE;
+					} else if (c == '-' || (c >= '0' && c <= '9')) {
+						double number;
+						err = _parse_number(number);
+						if (err == OK) {
+							err = p_handler->value(number);
+						}
+						state = STATE_AFTER_VALUE;
+					} else if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z')) {
+						err = _parse_literal(value);
+						if (err == OK) {
+							err = p_handler->value(value);
+						}
+						state = STATE_AFTER_VALUE;
+					} else if (c == END) {
+						err_str = "Expected value, got EOF.";
+						err = ERR_PARSE_ERROR;
+					} else {
+						err_str = "Unexpected character.";
+						err = ERR_PARSE_ERROR;
+					}
+					if (err) {
+						return err;
+					}
+				} break;
+				case STATE_ARRAY_FIRST: {
+					if (_skip_whitespace() == ']') {
+						_advance();
+						is_object_stack.resize(is_object_stack.size() - 1);
+						Error err = p_handler->end_array();
+						if (err) {
+							return err;
+						}
+						state = STATE_AFTER_VALUE;
+					} else {
+						state = STATE_VALUE;
+					}
+				} break;
+				case STATE_OBJECT_KEY: {
+					int c = _skip_whitespace();
+					if (c == '}') {
+						_advance();
+						is_object_stack.resize(is_object_stack.size() - 1);
+						Error err = p_handler->end_object();
+						if (err) {
+							return err;
+						}
+						state = STATE_AFTER_VALUE;
+						break;
+					}
+					if (c != '"') {
+						err_str = "Expected key";
+						return ERR_PARSE_ERROR;
+					}
+					_advance();
+					Error err = _parse_string(str);
+					if (err) {
+						return err;
+					}
+					err = p_handler->key(str);
+					if (err) {
+						return err;
+					}
+					if (_skip_whitespace() != ':') {
+						err_str = "Expected ':'";
+						return ERR_PARSE_ERROR;
+					}
+					_advance();
+					state = STATE_VALUE;
+				} break;
+				case STATE_AFTER_VALUE: {
+					int c = _skip_whitespace();
+					if (is_object_stack.size() == 0) {
+						if (c != END) {
+							err_str = "Expected 'EOF'";
+							return ERR_PARSE_ERROR;
+						}
+						return OK;
+					}
+
+					const bool in_object = is_object_stack[is_object_stack.size() - 1];
+					if (c == ',') {
+						_advance();
+						// Trailing commas are accepted, like in JSON::parse().
+						state = in_object ? STATE_OBJECT_KEY : STATE_ARRAY_FIRST;
+					} else if (in_object && c == '}') {
+						_advance();
+						is_object_stack.resize(is_object_stack.size() - 1);
+						Error err = p_handler->end_object();
+						if (err) {
+							return err;
+						}
+					} else if (!in_object && c == ']') {
+						_advance();
+						is_object_stack.resize(is_object_stack.size() - 1);
+						Error err = p_handler->end_array();
+						if (err) {
+							return err;
+						}
+					} else {
+						err_str = in_object ? "Expected '}' or ','" : "Expected ','";
+						return ERR_PARSE_ERROR;
+					}
+				} break;
+			}
+		}
+	}
+
+	JSONStreamParser(const uint8_t *p_data, int p_len) {
+		data = p_data;
+		data_len = p_len;
+	}
+
+	JSONStreamParser(FileAccess *p_file) {
+		file = p_file;
+		file_buffer.resize(FILE_BUFFER_SIZE);
+		data = file_buffer.ptr();
+	}
+};
+
+// Builds the Variant tree incrementally from the parse events.
+class JSONVariantBuilder : public JSON::Handler {
+	LocalVector<Variant> containers;
+	String pending_key;
+
+	void _add(const Variant &p_value) {
+		if (containers.size() == 0) {
+			result = p_value;
+			return;
+		}
+		const Variant &container = containers[containers.size() - 1];
+		if (container.get_type() == Variant::ARRAY) {
+			Array array = container;
+			array.push_back(p_value);
+		} else {
+			Dictionary dictionary = container;
+			dictionary[pending_key] = p_value;
+		}
+	}
+
+public:
+	Variant result;
+
+	virtual Error begin_object() override {
+		Dictionary d;
+		_add(d);
+		containers.push_back(d);
+		return OK;
+	}
+
+	virtual Error end_object() override {
+		containers.resize(containers.size() - 1);
+		return OK;
+	}
+
+	virtual Error begin_array() override {
+		Array a;
+		_add(a);
+		containers.push_back(a);
+		return OK;
+	}
+
+	virtual Error end_array() override {
+		containers.resize(containers.size() - 1);
+		return OK;
+	}
+
+	virtual Error key(const String &p_key) override {
+		pending_key = p_key;
+		return OK;
+	}
+
+	virtual Error value(const Variant &p_value) override {
+		_add(p_value);
+		return OK;
+	}
+};
+
+bool JSON::_parse_number(const char *p_str, int p_len, double &r_number) {
+	static const double pow10[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+
+	int i = 0;
+	bool negative = false;
+	if (i < p_len && p_str[i] == '-') {
+		negative = true;
+		i++;
+	}
+
+	uint64_t mantissa = 0;
+	int significant_digits = 0;
+	int exponent = 0;
+	bool exact = true;
+
+	int int_digits = 0;
+	while (i < p_len && p_str[i] >= '0' && p_str[i] <= '9') {
+		int d = p_str[i] - '0';
+		if (significant_digits < 19) {
+			mantissa = mantissa * 10 + d;
+			if (mantissa > 0) {
+				significant_digits++;
+			}
+		} else {
+			exponent++;
+			exact = false;
+		}
+		int_digits++;
+		i++;
+	}
+	if (int_digits == 0) {
+		return false;
+	}
+
+	if (i < p_len && p_str[i] == '.') {
+		i++;
+		int frac_digits = 0;
+		while (i < p_len && p_str[i] >= '0' && p_str[i] <= '9') {
+			int d = p_str[i] - '0';
+			if (significant_digits < 19) {
+				mantissa = mantissa * 10 + d;
+				if (mantissa > 0) {
+					significant_digits++;
+				}
+				exponent--;
+			} else {
+				exact = false;
+			}
+			frac_digits++;
+			i++;
+		}
+		if (frac_digits == 0) {
+			return false;
+		}
+	}
+
+	if (i < p_len && (p_str[i] == 'e' || p_str[i] == 'E')) {
+		i++;
+		bool exp_negative = false;
+		if (i < p_len && (p_str[i] == '-' || p_str[i] == '+')) {
+			exp_negative = p_str[i] == '-';
+			i++;
+		}
+		int exp_digits = 0;
+		int exp_value = 0;
+		while (i < p_len && p_str[i] >= '0' && p_str[i] <= '9') {
+			if (exp_value < 100000) {
+				exp_value = exp_value * 10 + (p_str[i] - '0');
+			}
+			exp_digits++;
+			i++;
+		}
+		if (exp_digits == 0) {
+			return false;
+		}
+		exponent += exp_negative ? -exp_value : exp_value;
+	}
+
+	if (i != p_len) {
+		return false;
+	}
+
+	// Both the mantissa and the power of ten are exactly representable as doubles,
+	// so a single multiplication or division gives the correctly rounded result.
+	if (exact && mantissa <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+		double value = double(mantissa);
+		value = exponent < 0 ? value / pow10[-exponent] : value * pow10[exponent];
+		r_number = negative ? -value : value;
+		return true;
+	}
+
+	r_number = String::to_float(p_str);
+	return true;
+}
+
+Error JSON::parse_stream(const uint8_t *p_data, int p_len, Handler *p_handler, String &r_err_str, int &r_err_line) {
+	ERR_FAIL_NULL_V(p_handler, ERR_INVALID_PARAMETER);
+
+	JSONStreamParser parser(p_data, p_len);
+	Error err = parser.parse(p_handler);
+	r_err_str = parser.err_str;
+	r_err_line = parser.line;
+	return err;
+}
+
+Error JSON::parse_stream(FileAccess *p_file, Handler *p_handler, String &r_err_str, int &r_err_line) {
+	ERR_FAIL_NULL_V(p_file, ERR_INVALID_PARAMETER);
+	ERR_FAIL_NULL_V(p_handler, ERR_INVALID_PARAMETER);
+
+	JSONStreamParser parser(p_file);
+	Error err = parser.parse(p_handler);
+	r_err_str = parser.err_str;
+	r_err_line = parser.line;
+	return err;
+}
+
+Error JSON::parse_utf8(const uint8_t *p_data, int p_len, Variant &r_ret, String &r_err_str, int &r_err_line) {
+	JSONVariantBuilder builder;
+	Error err = parse_stream(p_data, p_len, &builder, r_err_str, r_err_line);
+	r_ret = err == OK ? builder.result : Variant();
+	return err;
+}
+
+Error JSON::parse_file(FileAccess *p_file, Variant &r_ret, String &r_err_str, int &r_err_line) {
+	JSONVariantBuilder builder;
+	Error err = parse_stream(p_file, &builder, r_err_str, r_err_line);
+	r_ret = err == OK ? builder.result : Variant();
+	return err;
+}
+
 Error JSONParser::parse_string(const String &p_json_string) {
 	return JSON::parse(p_json_string, data, err_text, err_line);
 }
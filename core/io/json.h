@@ -33,6 +33,9 @@
 
 #include "core/object/reference.h"
 #include "core/variant/variant.h"
+
+class FileAccess;
+
 class JSON {
 	enum TokenType {
 		TK_CURLY_BRACKET_OPEN,
@@ -62,16 +65,73 @@ class JSON {
 
 	static const char *tk_name[TK_MAX];
 
-	static String _print_var(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys);
-
 	static Error _get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
 	static Error _parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, String &r_err_str);
 	static Error _parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, String &r_err_str);
 	static Error _parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, String &r_err_str);
 
+	friend class JSONStreamParser;
+	static bool _parse_number(const char *p_str, int p_len, double &r_number);
+
 public:
+	// Receives the events of a streaming parse in document order.
+	// Returning anything but OK from a callback stops the parse with that error.
+	class Handler {
+	public:
+		virtual Error begin_object() = 0;
+		virtual Error end_object() = 0;
+		virtual Error begin_array() = 0;
+		virtual Error end_array() = 0;
+		virtual Error key(const String &p_key) = 0;
+		virtual Error value(const Variant &p_value) = 0;
+
+		virtual ~Handler() {}
+	};
+
+	// Produces JSON text from events or whole values, into a String or
+	// incrementally into a file.
+	class Writer : public Handler {
+		struct Level {
+			bool is_object = false;
+			int count = 0;
+		};
+
+		FileAccess *file = nullptr;
+		String buffer;
+		Vector<Level> levels;
+		String indent;
+		bool sort_keys = true;
+
+		void _write(const String &p_string);
+		void _write(const char *p_literal);
+		void _write_indent(int p_level);
+		void _write_separator();
+		void _begin_value();
+
+	public:
+		virtual Error begin_object() override;
+		virtual Error end_object() override;
+		virtual Error begin_array() override;
+		virtual Error end_array() override;
+		virtual Error key(const String &p_key) override;
+		virtual Error value(const Variant &p_value) override;
+
+		Error flush();
+		String get_string() const;
+
+		Writer(const String &p_indent = "", bool p_sort_keys = true, FileAccess *p_file = nullptr);
+	};
+
 	static String print(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true);
+	static Error print_to_file(FileAccess *p_file, const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true);
+
 	static Error parse(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line);
+
+	// Parse UTF-8 text directly, without converting it to a String first.
+	static Error parse_utf8(const uint8_t *p_data, int p_len, Variant &r_ret, String &r_err_str, int &r_err_line);
+	static Error parse_file(FileAccess *p_file, Variant &r_ret, String &r_err_str, int &r_err_line);
+	static Error parse_stream(const uint8_t *p_data, int p_len, Handler *p_handler, String &r_err_str, int &r_err_line);
+	static Error parse_stream(FileAccess *p_file, Handler *p_handler, String &r_err_str, int &r_err_line);
 };
 
 class JSONParser : public Reference {
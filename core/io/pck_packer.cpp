@@ -48,6 +48,7 @@ static int _get_pad(int p_alignment, int p_n) {
 
 void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_name", "alignment", "key", "encrypt_directory"), &PCKPacker::pck_start, DEFVAL(0), DEFVAL(String()), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("set_base_pack", "base_pck_path"), &PCKPacker::set_base_pack);
 	ClassDB::bind_method(D_METHOD("add_file", "pck_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
 }
@@ -105,11 +106,78 @@ Error PCKPacker::pck_start(const String &p_file, int p_alignment, const String &
 	file->store_32(pack_flags); // flags
 
 	files.clear();
+	contents.clear();
+	base_files.clear();
 	ofs = 0;
 
 	return OK;
 }
 
+Error PCKPacker::set_base_pack(const String &p_base_pck) {
+	ERR_FAIL_COND_V_MSG(!file, ERR_INVALID_PARAMETER, "File must be opened before use.");
+
+	FileAccessRef f = FileAccess::open(p_base_pck, FileAccess::READ);
+	ERR_FAIL_COND_V_MSG(!f, ERR_FILE_CANT_OPEN, "Can't open base pack: " + p_base_pck + ".");
+
+	ERR_FAIL_COND_V_MSG(f->get_32() != PACK_HEADER_MAGIC, ERR_FILE_UNRECOGNIZED, "Base pack is not a PCK file: " + p_base_pck + ".");
+	ERR_FAIL_COND_V_MSG(f->get_32() != PACK_FORMAT_VERSION, ERR_FILE_UNRECOGNIZED, "Base pack version unsupported: " + p_base_pck + ".");
+	f->get_32(); // ver_major
+	f->get_32(); // ver_minor
+	f->get_32(); // ver_patch
+
+	uint32_t pack_flags = f->get_32();
+	f->get_64(); // files base
+
+	for (int i = 0; i < 16; i++) {
+		f->get_32(); // reserved
+	}
+
+	uint32_t file_count = f->get_32();
+
+	FileAccessEncrypted *fae = nullptr;
+	FileAccess *fhead = f;
+
+	if (pack_flags & PACK_DIR_ENCRYPTED) {
+		fae = memnew(FileAccessEncrypted);
+		Error err = fae->open_and_parse(f, key, FileAccessEncrypted::MODE_READ, false);
+		if (err != OK) {
+			memdelete(fae);
+			ERR_FAIL_V_MSG(ERR_FILE_CANT_OPEN, "Can't open encrypted base pack directory: " + p_base_pck + ".");
+		}
+		fhead = fae;
+	}
+
+	base_files.clear();
+
+	CharString cs;
+	for (uint32_t i = 0; i < file_count; i++) {
+		uint32_t sl = fhead->get_32();
+		cs.resize(sl + 1);
+		fhead->get_buffer((uint8_t *)cs.ptrw(), sl);
+		cs[sl] = 0;
+
+		String path;
+		path.parse_utf8(cs.ptr());
+
+		fhead->get_64(); // offset
+
+		BaseFile bf;
+		bf.size = fhead->get_64();
+		bf.md5.resize(16);
+		fhead->get_buffer(bf.md5.ptrw(), 16);
+		fhead->get_32(); // flags
+
+		base_files.set(path, bf);
+	}
+
+	if (fae) {
+		fae->release();
+		memdelete(fae);
+	}
+
+	return OK;
+}
+
 Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encrypt) {
 	FileAccess *f = FileAccess::open(p_src, FileAccess::READ);
 	if (!f) {
@@ -122,10 +190,23 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 	pf.ofs = ofs;
 	pf.size = f->get_length();
 
-	Vector<uint8_t> data = FileAccess::get_file_as_array(p_src);
 	{
+		CryptoCore::MD5Context ctx;
+		ctx.start();
+
+		uint8_t step[32768];
+		uint64_t left = pf.size;
+		while (left > 0) {
+			uint64_t br = f->get_buffer(step, MIN(left, sizeof(step)));
+			if (br == 0) {
+				break;
+			}
+			ctx.update(step, br);
+			left -= br;
+		}
+
 		unsigned char hash[16];
-		CryptoCore::md5(data.ptr(), data.size(), hash);
+		ctx.finish(hash);
 		pf.md5.resize(16);
 		for (int i = 0; i < 16; i++) {
 			pf.md5.write[i] = hash[i];
@@ -133,6 +214,26 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 	}
 	pf.encrypted = p_encrypt;
 
+	f->close();
+	memdelete(f);
+
+	// Unchanged files don't need to be in a patch for the base pack.
+	const BaseFile *bf = base_files.getptr(pf.path);
+	if (bf && bf->size == pf.size && bf->md5 == pf.md5) {
+		return OK;
+	}
+
+	// Identical contents are stored once, with every file pointing at them.
+	String content_key = String::md5(pf.md5.ptr()) + "-" + itos(pf.size) + (p_encrypt ? "-e" : "");
+	const int *shared = contents.getptr(content_key);
+	if (shared) {
+		pf.ofs = files[*shared].ofs;
+		pf.shared = true;
+		files.push_back(pf);
+		return OK;
+	}
+	contents.set(content_key, files.size());
+
 	uint64_t _size = pf.size;
 	if (p_encrypt) { // Add encryption overhead.
 		if (_size % 16) { // Pad to encryption block size.
@@ -148,9 +249,6 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 
 	files.push_back(pf);
 
-	f->close();
-	memdelete(f);
-
 	return OK;
 }
 
@@ -221,6 +319,11 @@ Error PCKPacker::flush(bool p_verbose) {
 
 	int count = 0;
 	for (int i = 0; i < files.size(); i++) {
+		if (files[i].shared) {
+			count += 1;
+			continue;
+		}
+
 		FileAccess *src = FileAccess::open(files[i].src_path, FileAccess::READ);
 		uint64_t to_write = files[i].size;
 
@@ -32,6 +32,7 @@
 #define PCK_PACKER_H
 
 #include "core/object/reference.h"
+#include "core/templates/hash_map.h"
 
 class FileAccess;
 
@@ -53,12 +54,23 @@ class PCKPacker : public Reference {
 		uint64_t ofs = 0;
 		uint64_t size = 0;
 		bool encrypted = false;
+		bool shared = false; // Data was already written for an identical file.
 		Vector<uint8_t> md5;
 	};
 	Vector<File> files;
 
+	// Content key (MD5, size and encryption) to the index of the first file with that content.
+	HashMap<String, int> contents;
+
+	struct BaseFile {
+		uint64_t size = 0;
+		Vector<uint8_t> md5;
+	};
+	HashMap<String, BaseFile> base_files;
+
 public:
 	Error pck_start(const String &p_file, int p_alignment = 0, const String &p_key = String(), bool p_encrypt_directory = false);
+	Error set_base_pack(const String &p_base_pck);
 	Error add_file(const String &p_file, const String &p_src, bool p_encrypt = false);
 	Error flush(bool p_verbose = false);
 
@@ -241,6 +241,9 @@ ClassDB::APIType ClassDB::get_current_api() {
 HashMap<StringName, ClassDB::ClassInfo> ClassDB::classes;
 HashMap<StringName, StringName> ClassDB::resource_base_extensions;
 HashMap<StringName, StringName> ClassDB::compat_classes;
+std::atomic<uint32_t> ClassDB::member_lookup_generation = { 0 };
+Mutex ClassDB::member_lookup_mutex;
+List<ClassDB::MemberLookup *> ClassDB::retired_member_lookups;
 
 bool ClassDB::_is_parent_class(const StringName &p_class, const StringName &p_inherits) {
 	if (!classes.has(p_class)) {
@@ -686,19 +689,64 @@ bool ClassDB::get_method_info(StringName p_class, StringName p_method, MethodInf
 	return false;
 }
 
+static MethodBind *_find_method(ClassDB::ClassInfo *p_class, const StringName &p_name) {
+	while (p_class) {
+		MethodBind **method = p_class->method_map.getptr(p_name);
+		if (method && *method) {
+			return *method;
+		}
+		p_class = p_class->inherits_ptr;
+	}
+	return nullptr;
+}
+
 MethodBind *ClassDB::get_method(StringName p_class, StringName p_name) {
+	ClassInfo *type = classes.getptr(p_class);
+	if (!type) {
+		return nullptr;
+	}
+
+	MethodBind *const *method = _get_member_lookup(type)->method_map.getptr(p_name);
+	return method ? *method : nullptr;
+}
+
+ClassDB::MemberLookup *ClassDB::_build_member_lookup(ClassInfo *p_class) {
+	// Only taken when the lookup is missing or outdated, which is rare after registration.
 	OBJTYPE_RLOCK;
+	MutexLock mutex_lock(member_lookup_mutex);
 
-	ClassInfo *type = classes.getptr(p_class);
+	uint32_t generation = member_lookup_generation.load(std::memory_order_acquire);
+	MemberLookup *previous = p_class->member_lookup.ptr.load(std::memory_order_acquire);
+	if (previous && previous->generation == generation) {
+		return previous; // Built by another thread meanwhile.
+	}
 
-	while (type) {
-		MethodBind **method = type->method_map.getptr(p_name);
-		if (method && *method) {
-			return *method;
+	MemberLookup *lookup = memnew(MemberLookup);
+	lookup->generation = generation;
+
+	// Walk from the class up, so members of derived classes take precedence.
+	for (ClassInfo *check = p_class; check; check = check->inherits_ptr) {
+		const StringName *k = nullptr;
+		while ((k = check->method_map.next(k))) {
+			MethodBind *method = *check->method_map.getptr(*k);
+			if (method && !lookup->method_map.has(*k)) {
+				lookup->method_map.set(*k, method);
+			}
+		}
+
+		k = nullptr;
+		while ((k = check->property_setget.next(k))) {
+			if (!lookup->property_setget.has(*k)) {
+				lookup->property_setget.set(*k, check->property_setget.getptr(*k));
+			}
 		}
-		type = type->inherits_ptr;
 	}
-	return nullptr;
+
+	p_class->member_lookup.ptr.store(lookup, std::memory_order_release);
+	if (previous) {
+		retired_member_lookups.push_back(previous);
+	}
+	return lookup;
 }
 
 void ClassDB::bind_integer_constant(const StringName &p_class, const StringName &p_enum, const StringName &p_name, int p_constant) {
@@ -991,7 +1039,7 @@ void ClassDB::add_property(StringName p_class, const PropertyInfo &p_pinfo, cons
 
 	MethodBind *mb_set = nullptr;
 	if (p_setter) {
-		mb_set = get_method(p_class, p_setter);
+		mb_set = _find_method(type, p_setter);
 #ifdef DEBUG_METHODS_ENABLED
 
 		ERR_FAIL_COND_MSG(!mb_set, "Invalid setter '" + p_class + "::" + p_setter + "' for property '" + p_pinfo.name + "'.");
@@ -1003,7 +1051,7 @@ void ClassDB::add_property(StringName p_class, const PropertyInfo &p_pinfo, cons
 
 	MethodBind *mb_get = nullptr;
 	if (p_getter) {
-		mb_get = get_method(p_class, p_getter);
+		mb_get = _find_method(type, p_getter);
 #ifdef DEBUG_METHODS_ENABLED
 
 		ERR_FAIL_COND_MSG(!mb_get, "Invalid getter '" + p_class + "::" + p_getter + "' for property '" + p_pinfo.name + "'.");
@@ -1038,6 +1086,7 @@ void ClassDB::add_property(StringName p_class, const PropertyInfo &p_pinfo, cons
 	psg.type = p_pinfo.type;
 
 	type->property_setget[p_pinfo.name] = psg;
+	_invalidate_member_lookups();
 }
 
 void ClassDB::set_property_default_value(StringName p_class, const StringName &p_name, const Variant &p_default) {
@@ -1097,81 +1146,83 @@ bool ClassDB::get_property_info(StringName p_class, StringName p_property, Prope
 bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
 	ERR_FAIL_NULL_V(p_object, false);
 
-	ClassInfo *type = classes.getptr(p_object->get_class_name());
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
-		if (psg) {
-			if (!psg->setter) {
-				if (r_valid) {
-					*r_valid = false;
-				}
-				return true; //return true but do nothing
-			}
-
-			Callable::CallError ce;
+	const PropertySetGet *psg = get_property_setget(p_object->get_class_name(), p_property);
+	if (!psg) {
+		return false;
+	}
 
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[2] = { &index, &p_value };
-				//p_object->call(psg->setter,arg,2,ce);
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 2, ce);
-				} else {
-					p_object->call(psg->setter, arg, 2, ce);
-				}
+	if (!psg->setter) {
+		if (r_valid) {
+			*r_valid = false;
+		}
+		return true; //return true but do nothing
+	}
 
-			} else {
-				const Variant *arg[1] = { &p_value };
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 1, ce);
-				} else {
-					p_object->call(psg->setter, arg, 1, ce);
-				}
-			}
+	Callable::CallError ce;
 
-			if (r_valid) {
-				*r_valid = ce.error == Callable::CallError::CALL_OK;
-			}
+	if (psg->index >= 0) {
+		Variant index = psg->index;
+		const Variant *arg[2] = { &index, &p_value };
+		//p_object->call(psg->setter,arg,2,ce);
+		if (psg->_setptr) {
+			psg->_setptr->call(p_object, arg, 2, ce);
+		} else {
+			p_object->call(psg->setter, arg, 2, ce);
+		}
 
-			return true;
+	} else {
+		const Variant *arg[1] = { &p_value };
+		if (psg->_setptr) {
+			psg->_setptr->call(p_object, arg, 1, ce);
+		} else {
+			p_object->call(psg->setter, arg, 1, ce);
 		}
+	}
 
-		check = check->inherits_ptr;
+	if (ce.error == Callable::CallError::CALL_OK && p_object->is_tracking_property_changes()) {
+		p_object->mark_property_changed(p_property);
 	}
 
-	return false;
+	if (r_valid) {
+		*r_valid = ce.error == Callable::CallError::CALL_OK;
+	}
+
+	return true;
 }
 
 bool ClassDB::get_property(Object *p_object, const StringName &p_property, Variant &r_value) {
 	ERR_FAIL_NULL_V(p_object, false);
 
 	ClassInfo *type = classes.getptr(p_object->get_class_name());
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
-		if (psg) {
-			if (!psg->getter) {
-				return true; //return true but do nothing
-			}
+	if (!type) {
+		return false;
+	}
+
+	const PropertySetGet *psg = get_property_setget(p_object->get_class_name(), p_property);
+	if (psg) {
+		if (!psg->getter) {
+			return true; //return true but do nothing
+		}
 
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[1] = { &index };
-				Callable::CallError ce;
-				r_value = p_object->call(psg->getter, arg, 1, ce);
+		if (psg->index >= 0) {
+			Variant index = psg->index;
+			const Variant *arg[1] = { &index };
+			Callable::CallError ce;
+			r_value = p_object->call(psg->getter, arg, 1, ce);
 
+		} else {
+			Callable::CallError ce;
+			if (psg->_getptr) {
+				r_value = psg->_getptr->call(p_object, nullptr, 0, ce);
 			} else {
-				Callable::CallError ce;
-				if (psg->_getptr) {
-					r_value = psg->_getptr->call(p_object, nullptr, 0, ce);
-				} else {
-					r_value = p_object->call(psg->getter, nullptr, 0, ce);
-				}
+				r_value = p_object->call(psg->getter, nullptr, 0, ce);
 			}
-			return true;
 		}
+		return true;
+	}
 
+	ClassInfo *check = type;
+	while (check) {
 		const int *c = check->constant_map.getptr(p_property); //constants count
 		if (c) {
 			r_value = *c;
@@ -1195,20 +1246,15 @@ bool ClassDB::get_property(Object *p_object, const StringName &p_property, Varia
 }
 
 int ClassDB::get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
-	ClassInfo *type = classes.getptr(p_class);
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
-		if (psg) {
-			if (r_is_valid) {
-				*r_is_valid = true;
-			}
-
-			return psg->index;
+	const PropertySetGet *psg = get_property_setget(p_class, p_property);
+	if (psg) {
+		if (r_is_valid) {
+			*r_is_valid = true;
 		}
 
-		check = check->inherits_ptr;
+		return psg->index;
 	}
+
 	if (r_is_valid) {
 		*r_is_valid = false;
 	}
@@ -1253,6 +1299,16 @@ StringName ClassDB::get_property_setter(StringName p_class, const StringName &p_
 	return StringName();
 }
 
+const ClassDB::PropertySetGet *ClassDB::get_property_setget(const StringName &p_class, const StringName &p_property) {
+	ClassInfo *type = classes.getptr(p_class);
+	if (!type) {
+		return nullptr;
+	}
+
+	const PropertySetGet *const *psg = _get_member_lookup(type)->property_setget.getptr(p_property);
+	return psg ? *psg : nullptr;
+}
+
 StringName ClassDB::get_property_getter(StringName p_class, const StringName &p_property) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -1354,6 +1410,7 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const c
 #endif
 
 	type->method_map[mdname] = p_bind;
+	_invalidate_member_lookups();
 
 	Vector<Variant> defvals;
 
@@ -1564,7 +1621,16 @@ void ClassDB::cleanup() {
 		while ((m = ti.method_map.next(m))) {
 			memdelete(ti.method_map[*m]);
 		}
+
+		MemberLookup *lookup = ti.member_lookup.ptr.load();
+		if (lookup) {
+			memdelete(lookup);
+		}
+	}
+	for (List<MemberLookup *>::Element *E = retired_member_lookups.front(); E; E = E->next()) {
+		memdelete(E->get());
 	}
+	retired_member_lookups.clear();
 	classes.clear();
 	resource_base_extensions.clear();
 	compat_classes.clear();
@@ -33,6 +33,7 @@
 
 #include "core/object/method_bind.h"
 #include "core/object/object.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 
 /** To bind more then 6 parameters include this:
@@ -110,6 +111,14 @@ public:
 		Variant::Type type;
 	};
 
+	// Own and inherited methods and properties of a class, to find them without
+	// walking the inheritance chain. Built on first use, never modified after.
+	struct MemberLookup {
+		uint32_t generation = 0;
+		HashMap<StringName, MethodBind *> method_map;
+		HashMap<StringName, const PropertySetGet *> property_setget;
+	};
+
 	struct ClassInfo {
 		APIType api = API_NONE;
 		ClassInfo *inherits_ptr = nullptr;
@@ -131,6 +140,19 @@ public:
 #endif
 		HashMap<StringName, PropertySetGet> property_setget;
 
+		// Published atomically, so it can be read without locking.
+		struct MemberLookupPtr {
+			std::atomic<MemberLookup *> ptr = { nullptr };
+
+			MemberLookupPtr() {}
+			MemberLookupPtr(const MemberLookupPtr &p_other) :
+					ptr(p_other.ptr.load()) {}
+			MemberLookupPtr &operator=(const MemberLookupPtr &p_other) {
+				ptr.store(p_other.ptr.load());
+				return *this;
+			}
+		} member_lookup;
+
 		StringName inherits;
 		StringName name;
 		bool disabled = false;
@@ -164,6 +186,25 @@ public:
 	static HashMap<StringName, HashMap<StringName, Variant>> default_values;
 	static Set<StringName> default_values_cached;
 
+	// Lookups are read without locking. Registering a member bumps the generation,
+	// so lookups built before are rebuilt on next use. Replaced lookups may still
+	// be in use by readers, they are only freed on cleanup.
+	static std::atomic<uint32_t> member_lookup_generation;
+	static Mutex member_lookup_mutex;
+	static List<MemberLookup *> retired_member_lookups;
+
+	static MemberLookup *_build_member_lookup(ClassInfo *p_class);
+	_FORCE_INLINE_ static void _invalidate_member_lookups() {
+		member_lookup_generation.fetch_add(1, std::memory_order_release);
+	}
+	_FORCE_INLINE_ static const MemberLookup *_get_member_lookup(ClassInfo *p_class) {
+		MemberLookup *lookup = p_class->member_lookup.ptr.load(std::memory_order_acquire);
+		if (likely(lookup && lookup->generation == member_lookup_generation.load(std::memory_order_acquire))) {
+			return lookup;
+		}
+		return _build_member_lookup(p_class);
+	}
+
 private:
 	// Non-locking variants of get_parent_class and is_parent_class.
 	static StringName _get_parent_class(const StringName &p_class);
@@ -352,6 +393,7 @@ public:
 	static Variant::Type get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
 	static StringName get_property_setter(StringName p_class, const StringName &p_property);
 	static StringName get_property_getter(StringName p_class, const StringName &p_property);
+	static const PropertySetGet *get_property_setget(const StringName &p_class, const StringName &p_property);
 
 	static bool has_method(StringName p_class, StringName p_method, bool p_no_inheritance = false);
 	static void set_method_flags(StringName p_class, StringName p_method, int p_flags);
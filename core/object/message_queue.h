@@ -74,16 +74,35 @@ public:
 	static MessageQueue *get_singleton();
 
 	Error push_call(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error = false);
-	Error push_call(ObjectID p_id, const StringName &p_method, VARIANT_ARG_LIST);
+	Error push_call(ObjectID p_id, const StringName &p_method, VARIANT_ARG_DECLARE);
 	Error push_notification(ObjectID p_id, int p_notification);
 	Error push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value);
 	Error push_callable(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error = false);
-	Error push_callable(const Callable &p_callable, VARIANT_ARG_LIST);
+	Error push_callable(const Callable &p_callable, VARIANT_ARG_DECLARE);
 
-	Error push_call(Object *p_object, const StringName &p_method, VARIANT_ARG_LIST);
+	Error push_call(Object *p_object, const StringName &p_method, VARIANT_ARG_DECLARE);
 	Error push_notification(Object *p_object, int p_notification);
 	Error push_set(Object *p_object, const StringName &p_prop, const Variant &p_value);
 
+	// Variadic versions, these pass exactly the given arguments.
+	template <class... VarArgs, VARIANT_CALL_ARGS_ENABLE(VarArgs)>
+	Error push_call(ObjectID p_id, const StringName &p_method, const VarArgs &...p_args) {
+		VariantCallArgs<sizeof...(p_args)> args(p_args...);
+		return push_call(p_id, p_method, args.get(), sizeof...(p_args));
+	}
+
+	template <class... VarArgs, VARIANT_CALL_ARGS_ENABLE(VarArgs)>
+	Error push_call(Object *p_object, const StringName &p_method, const VarArgs &...p_args) {
+		VariantCallArgs<sizeof...(p_args)> args(p_args...);
+		return push_call(p_object->get_instance_id(), p_method, args.get(), sizeof...(p_args));
+	}
+
+	template <class... VarArgs, VARIANT_CALL_ARGS_ENABLE(VarArgs)>
+	Error push_callable(const Callable &p_callable, const VarArgs &...p_args) {
+		VariantCallArgs<sizeof...(p_args)> args(p_args...);
+		return push_callable(p_callable, args.get(), sizeof...(p_args));
+	}
+
 	void statistics();
 	void flush();
 
@@ -378,6 +378,9 @@ void Object::set(const StringName &p_name, const Variant &p_value, bool *r_valid
 
 	if (script_instance) {
 		if (script_instance->set(p_name, p_value)) {
+			if (property_changes) {
+				mark_property_changed(p_name);
+			}
 			if (r_valid) {
 				*r_valid = true;
 			}
@@ -398,6 +401,9 @@ void Object::set(const StringName &p_name, const Variant &p_value, bool *r_valid
 
 	if (p_name == CoreStringNames::get_singleton()->_script) {
 		set_script(p_value);
+		if (property_changes) {
+			mark_property_changed(p_name);
+		}
 		if (r_valid) {
 			*r_valid = true;
 		}
@@ -406,6 +412,9 @@ void Object::set(const StringName &p_name, const Variant &p_value, bool *r_valid
 	} else if (p_name == CoreStringNames::get_singleton()->_meta) {
 		//set_meta(p_name,p_value);
 		metadata = p_value.duplicate();
+		if (property_changes) {
+			mark_property_changed(p_name);
+		}
 		if (r_valid) {
 			*r_valid = true;
 		}
@@ -415,6 +424,9 @@ void Object::set(const StringName &p_name, const Variant &p_value, bool *r_valid
 	//something inside the object... :|
 	bool success = _setv(p_name, p_value);
 	if (success) {
+		if (property_changes) {
+			mark_property_changed(p_name);
+		}
 		if (r_valid) {
 			*r_valid = true;
 		}
@@ -426,6 +438,9 @@ void Object::set(const StringName &p_name, const Variant &p_value, bool *r_valid
 		bool valid;
 		script_instance->property_set_fallback(p_name, p_value, &valid);
 		if (valid) {
+			if (property_changes) {
+				mark_property_changed(p_name);
+			}
 			if (r_valid) {
 				*r_valid = true;
 			}
@@ -921,6 +936,57 @@ Vector<String> Object::_get_meta_list_bind() const {
 	return _metaret;
 }
 
+Vector<String> Object::_get_changed_properties_bind() const {
+	Vector<String> ret;
+	if (property_changes) {
+		ret.resize(property_changes->properties.size());
+		for (uint32_t i = 0; i < property_changes->properties.size(); i++) {
+			ret.write[i] = property_changes->properties[i];
+		}
+	}
+	return ret;
+}
+
+void Object::set_track_property_changes(bool p_enable) {
+	if (p_enable == (property_changes != nullptr)) {
+		return;
+	}
+
+	if (p_enable) {
+		property_changes = memnew(PropertyChanges);
+	} else {
+		memdelete(property_changes);
+		property_changes = nullptr;
+	}
+}
+
+void Object::mark_property_changed(const StringName &p_name) {
+	ERR_FAIL_COND_MSG(!property_changes, "Property changes are not being tracked for this object.");
+
+	if (property_changes->indices.has(p_name)) {
+		return;
+	}
+	property_changes->indices.set(p_name, property_changes->properties.size());
+	property_changes->properties.push_back(p_name);
+}
+
+void Object::get_changed_properties(List<StringName> *r_properties) const {
+	if (!property_changes) {
+		return;
+	}
+	for (uint32_t i = 0; i < property_changes->properties.size(); i++) {
+		r_properties->push_back(property_changes->properties[i]);
+	}
+}
+
+void Object::clear_changed_properties() {
+	if (!property_changes || property_changes->properties.is_empty()) {
+		return;
+	}
+	property_changes->properties.clear();
+	property_changes->indices.clear();
+}
+
 void Object::get_meta_list(List<String> *p_list) const {
 	List<Variant> keys;
 	metadata.get_key_list(&keys);
@@ -1507,6 +1573,12 @@ void Object::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("has_meta", "name"), &Object::has_meta);
 	ClassDB::bind_method(D_METHOD("get_meta_list"), &Object::_get_meta_list_bind);
 
+	ClassDB::bind_method(D_METHOD("set_track_property_changes", "enable"), &Object::set_track_property_changes);
+	ClassDB::bind_method(D_METHOD("is_tracking_property_changes"), &Object::is_tracking_property_changes);
+	ClassDB::bind_method(D_METHOD("mark_property_changed", "property"), &Object::mark_property_changed);
+	ClassDB::bind_method(D_METHOD("get_changed_properties"), &Object::_get_changed_properties_bind);
+	ClassDB::bind_method(D_METHOD("clear_changed_properties"), &Object::clear_changed_properties);
+
 	ClassDB::bind_method(D_METHOD("add_user_signal", "signal", "arguments"), &Object::_add_user_signal, DEFVAL(Array()));
 	ClassDB::bind_method(D_METHOD("has_user_signal", "signal"), &Object::_has_user_signal);
 
@@ -1770,6 +1842,11 @@ Object::~Object() {
 	}
 	script_instance = nullptr;
 
+	if (property_changes) {
+		memdelete(property_changes);
+		property_changes = nullptr;
+	}
+
 	const StringName *S = nullptr;
 
 	if (_emitting) {
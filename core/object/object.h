@@ -36,6 +36,7 @@
 #include "core/os/spin_lock.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/map.h"
 #include "core/templates/safe_refcount.h"
 #include "core/templates/set.h"
@@ -471,6 +472,13 @@ private:
 	ScriptInstance *script_instance = nullptr;
 	Variant script; //reference does not yet exist, store it in a
 	Dictionary metadata;
+
+	// Only allocated while tracking property changes.
+	struct PropertyChanges {
+		LocalVector<StringName> properties; // In the order they changed.
+		HashMap<StringName, uint32_t> indices;
+	};
+	PropertyChanges *property_changes = nullptr;
 	mutable StringName _class_name;
 	mutable const StringName *_class_ptr = nullptr;
 
@@ -540,6 +548,7 @@ protected:
 	}
 
 	Vector<String> _get_meta_list_bind() const;
+	Vector<String> _get_changed_properties_bind() const;
 	Array _get_property_list_bind() const;
 	Array _get_method_list_bind() const;
 
@@ -639,7 +648,14 @@ public:
 	void get_method_list(List<MethodInfo> *p_list) const;
 	Variant callv(const StringName &p_method, const Array &p_args);
 	virtual Variant call(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
-	Variant call(const StringName &p_name, VARIANT_ARG_LIST); // C++ helper
+	Variant call(const StringName &p_name, VARIANT_ARG_DECLARE); // C++ helper
+
+	template <class... VarArgs, VARIANT_CALL_ARGS_ENABLE(VarArgs)>
+	Variant call(const StringName &p_name, const VarArgs &...p_args) { // C++ helper, passes exactly the given arguments.
+		VariantCallArgs<sizeof...(p_args)> args(p_args...);
+		Callable::CallError error;
+		return call(p_name, args.get(), sizeof...(p_args), error);
+	}
 
 	void notification(int p_notification, bool p_reversed = false);
 	virtual String to_string();
@@ -661,6 +677,13 @@ public:
 	Variant get_meta(const String &p_name) const;
 	void get_meta_list(List<String> *p_list) const;
 
+	void set_track_property_changes(bool p_enable);
+	_FORCE_INLINE_ bool is_tracking_property_changes() const { return property_changes != nullptr; }
+	_FORCE_INLINE_ bool has_changed_properties() const { return property_changes && !property_changes->properties.is_empty(); }
+	void mark_property_changed(const StringName &p_name);
+	void get_changed_properties(List<StringName> *r_properties) const;
+	void clear_changed_properties();
+
 #ifdef TOOLS_ENABLED
 	void set_edited(bool p_edited);
 	bool is_edited() const;
@@ -686,7 +709,12 @@ public:
 	void disconnect(const StringName &p_signal, const Callable &p_callable);
 	bool is_connected(const StringName &p_signal, const Callable &p_callable) const;
 
-	void call_deferred(const StringName &p_method, VARIANT_ARG_LIST);
+	void call_deferred(const StringName &p_method, VARIANT_ARG_DECLARE);
+
+	template <class... VarArgs, VARIANT_CALL_ARGS_ENABLE(VarArgs)>
+	void call_deferred(const StringName &p_method, const VarArgs &...p_args) {
+		Callable(this, p_method).call_deferred(p_args...);
+	}
 	void set_deferred(const StringName &p_property, const Variant &p_value);
 
 	void set_block_signals(bool p_block);
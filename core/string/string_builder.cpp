@@ -61,7 +61,10 @@ String StringBuilder::as_string() const {
 		return "";
 	}
 
-	char32_t *buffer = memnew_arr(char32_t, string_length);
+	// Write straight into the result, so the pieces are only copied once.
+	String final_string;
+	final_string.resize(string_length + 1);
+	char32_t *buffer = final_string.ptrw();
 
 	int current_position = 0;
 
@@ -82,7 +85,7 @@ String StringBuilder::as_string() const {
 			const char *s = c_strings[c_string_elem];
 
 			for (int32_t j = 0; j < appended_strings[i]; j++) {
-				buffer[current_position + j] = s[j];
+				buffer[current_position + j] = (uint8_t)s[j];
 			}
 
 			current_position += appended_strings[i];
@@ -91,9 +94,7 @@ String StringBuilder::as_string() const {
 		}
 	}
 
-	String final_string = String(buffer, string_length);
-
-	memdelete_arr(buffer);
+	buffer[string_length] = 0;
 
 	return final_string;
 }
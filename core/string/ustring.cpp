@@ -54,6 +54,268 @@
 #define snprintf _snprintf_s
 #endif
 
+// SSE2 is part of the x86_64 baseline, NEON is always available on arm64.
+// Other targets use the scalar code paths below.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USTRING_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define USTRING_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+/*
+ * Bulk helpers for the Unicode conversion and search functions.
+ * Each one handles the longest prefix it can process without decoding
+ * and returns its length, leaving the remainder to the scalar code.
+ */
+
+// Length of the prefix of non-zero 7-bit ASCII bytes.
+static _FORCE_INLINE_ int _utf8_ascii_prefix(const uint8_t *p_src, int p_len) {
+	int i = 0;
+#if defined(USTRING_SIMD_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 16 <= p_len; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(p_src + i));
+		if (_mm_movemask_epi8(_mm_or_si128(v, _mm_cmpeq_epi8(v, zero))) != 0) {
+			break;
+		}
+	}
+#elif defined(USTRING_SIMD_NEON)
+	for (; i + 16 <= p_len; i += 16) {
+		uint8x16_t v = vld1q_u8(p_src + i);
+		if (vmaxvq_u8(v) >= 0x80 || vminvq_u8(v) == 0) {
+			break;
+		}
+	}
+#endif
+	while (i < p_len && p_src[i] != 0 && p_src[i] < 0x80) {
+		i++;
+	}
+	return i;
+}
+
+// Widens the prefix of 7-bit ASCII bytes into p_dst.
+static _FORCE_INLINE_ int _utf8_widen_ascii(const uint8_t *p_src, int p_len, char32_t *p_dst) {
+	int i = 0;
+#if defined(USTRING_SIMD_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 16 <= p_len; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(p_src + i));
+		if (_mm_movemask_epi8(v) != 0) {
+			break;
+		}
+		__m128i lo = _mm_unpacklo_epi8(v, zero);
+		__m128i hi = _mm_unpackhi_epi8(v, zero);
+		_mm_storeu_si128((__m128i *)(p_dst + i), _mm_unpacklo_epi16(lo, zero));
+		_mm_storeu_si128((__m128i *)(p_dst + i + 4), _mm_unpackhi_epi16(lo, zero));
+		_mm_storeu_si128((__m128i *)(p_dst + i + 8), _mm_unpacklo_epi16(hi, zero));
+		_mm_storeu_si128((__m128i *)(p_dst + i + 12), _mm_unpackhi_epi16(hi, zero));
+	}
+#elif defined(USTRING_SIMD_NEON)
+	for (; i + 16 <= p_len; i += 16) {
+		uint8x16_t v = vld1q_u8(p_src + i);
+		if (vmaxvq_u8(v) >= 0x80) {
+			break;
+		}
+		uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+		uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+		vst1q_u32((uint32_t *)(p_dst + i), vmovl_u16(vget_low_u16(lo)));
+		vst1q_u32((uint32_t *)(p_dst + i + 4), vmovl_u16(vget_high_u16(lo)));
+		vst1q_u32((uint32_t *)(p_dst + i + 8), vmovl_u16(vget_low_u16(hi)));
+		vst1q_u32((uint32_t *)(p_dst + i + 12), vmovl_u16(vget_high_u16(hi)));
+	}
+#endif
+	for (; i < p_len && p_src[i] < 0x80; i++) {
+		p_dst[i] = p_src[i];
+	}
+	return i;
+}
+
+// Length of the prefix of non-zero UTF-16 units that are not surrogates.
+static _FORCE_INLINE_ int _utf16_single_prefix(const char16_t *p_src, int p_len) {
+	int i = 0;
+#if defined(USTRING_SIMD_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i surrogate_mask = _mm_set1_epi16((short)0xf800);
+	const __m128i surrogate = _mm_set1_epi16((short)0xd800);
+	for (; i + 8 <= p_len; i += 8) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(p_src + i));
+		__m128i bad = _mm_or_si128(_mm_cmpeq_epi16(_mm_and_si128(v, surrogate_mask), surrogate), _mm_cmpeq_epi16(v, zero));
+		if (_mm_movemask_epi8(bad) != 0) {
+			break;
+		}
+	}
+#elif defined(USTRING_SIMD_NEON)
+	for (; i + 8 <= p_len; i += 8) {
+		uint16x8_t v = vld1q_u16((const uint16_t *)(p_src + i));
+		uint16x8_t bad = vorrq_u16(vceqq_u16(vandq_u16(v, vdupq_n_u16(0xf800)), vdupq_n_u16(0xd800)), vceqq_u16(v, vdupq_n_u16(0)));
+		if (vmaxvq_u16(bad) != 0) {
+			break;
+		}
+	}
+#endif
+	while (i < p_len && p_src[i] != 0 && (p_src[i] & 0xf800) != 0xd800) {
+		i++;
+	}
+	return i;
+}
+
+// Widens the prefix of UTF-16 units that are not surrogates into p_dst.
+static _FORCE_INLINE_ int _utf16_widen_single(const char16_t *p_src, int p_len, char32_t *p_dst) {
+	int i = 0;
+#if defined(USTRING_SIMD_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i surrogate_mask = _mm_set1_epi16((short)0xf800);
+	const __m128i surrogate = _mm_set1_epi16((short)0xd800);
+	for (; i + 8 <= p_len; i += 8) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(p_src + i));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, surrogate_mask), surrogate)) != 0) {
+			break;
+		}
+		_mm_storeu_si128((__m128i *)(p_dst + i), _mm_unpacklo_epi16(v, zero));
+		_mm_storeu_si128((__m128i *)(p_dst + i + 4), _mm_unpackhi_epi16(v, zero));
+	}
+#elif defined(USTRING_SIMD_NEON)
+	for (; i + 8 <= p_len; i += 8) {
+		uint16x8_t v = vld1q_u16((const uint16_t *)(p_src + i));
+		if (vmaxvq_u16(vceqq_u16(vandq_u16(v, vdupq_n_u16(0xf800)), vdupq_n_u16(0xd800))) != 0) {
+			break;
+		}
+		vst1q_u32((uint32_t *)(p_dst + i), vmovl_u16(vget_low_u16(v)));
+		vst1q_u32((uint32_t *)(p_dst + i + 4), vmovl_u16(vget_high_u16(v)));
+	}
+#endif
+	for (; i < p_len && (p_src[i] & 0xf800) != 0xd800; i++) {
+		p_dst[i] = p_src[i];
+	}
+	return i;
+}
+
+// Length of the prefix of code points strictly below p_limit.
+static _FORCE_INLINE_ int _utf32_prefix_below(const char32_t *p_src, int p_len, uint32_t p_limit) {
+	int i = 0;
+#if defined(USTRING_SIMD_SSE2)
+	// SSE2 only has signed comparisons, flip the sign bit to compare unsigned values.
+	const __m128i sign = _mm_set1_epi32((int)0x80000000);
+	const __m128i limit = _mm_xor_si128(_mm_set1_epi32((int)p_limit), sign);
+	for (; i + 4 <= p_len; i += 4) {
+		__m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(p_src + i)), sign);
+		if (_mm_movemask_epi8(_mm_cmplt_epi32(v, limit)) != 0xffff) {
+			break;
+		}
+	}
+#elif defined(USTRING_SIMD_NEON)
+	for (; i + 4 <= p_len; i += 4) {
+		if (vmaxvq_u32(vld1q_u32((const uint32_t *)(p_src + i))) >= p_limit) {
+			break;
+		}
+	}
+#endif
+	while (i < p_len && uint32_t(p_src[i]) < p_limit) {
+		i++;
+	}
+	return i;
+}
+
+// Narrows the prefix of 7-bit ASCII code points into p_dst.
+static _FORCE_INLINE_ int _utf32_narrow_ascii(const char32_t *p_src, int p_len, uint8_t *p_dst) {
+	int i = 0;
+#if defined(USTRING_SIMD_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i high_bits = _mm_set1_epi32(~0x7f);
+	for (; i + 16 <= p_len; i += 16) {
+		__m128i a = _mm_loadu_si128((const __m128i *)(p_src + i));
+		__m128i b = _mm_loadu_si128((const __m128i *)(p_src + i + 4));
+		__m128i c = _mm_loadu_si128((const __m128i *)(p_src + i + 8));
+		__m128i d = _mm_loadu_si128((const __m128i *)(p_src + i + 12));
+		__m128i all = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(all, high_bits), zero)) != 0xffff) {
+			break;
+		}
+		_mm_storeu_si128((__m128i *)(p_dst + i), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+	}
+#elif defined(USTRING_SIMD_NEON)
+	for (; i + 16 <= p_len; i += 16) {
+		uint32x4_t a = vld1q_u32((const uint32_t *)(p_src + i));
+		uint32x4_t b = vld1q_u32((const uint32_t *)(p_src + i + 4));
+		uint32x4_t c = vld1q_u32((const uint32_t *)(p_src + i + 8));
+		uint32x4_t d = vld1q_u32((const uint32_t *)(p_src + i + 12));
+		if (vmaxvq_u32(vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d))) >= 0x80) {
+			break;
+		}
+		uint16x8_t ab = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+		uint16x8_t cd = vcombine_u16(vmovn_u32(c), vmovn_u32(d));
+		vst1q_u8(p_dst + i, vcombine_u8(vmovn_u16(ab), vmovn_u16(cd)));
+	}
+#endif
+	for (; i < p_len && uint32_t(p_src[i]) <= 0x7f; i++) {
+		p_dst[i] = p_src[i];
+	}
+	return i;
+}
+
+// Narrows the prefix of code points below the surrogate range into p_dst.
+static _FORCE_INLINE_ int _utf32_narrow_single(const char32_t *p_src, int p_len, uint16_t *p_dst) {
+	int i = 0;
+#if defined(USTRING_SIMD_SSE2)
+	const __m128i sign = _mm_set1_epi32((int)0x80000000);
+	const __m128i limit = _mm_set1_epi32((int)(0xd800 ^ 0x80000000));
+	// Values are biased into the signed 16-bit range so they survive the saturating pack.
+	const __m128i bias = _mm_set1_epi32(0x8000);
+	const __m128i unbias = _mm_set1_epi16((short)0x8000);
+	for (; i + 8 <= p_len; i += 8) {
+		__m128i a = _mm_loadu_si128((const __m128i *)(p_src + i));
+		__m128i b = _mm_loadu_si128((const __m128i *)(p_src + i + 4));
+		__m128i ok = _mm_and_si128(_mm_cmplt_epi32(_mm_xor_si128(a, sign), limit), _mm_cmplt_epi32(_mm_xor_si128(b, sign), limit));
+		if (_mm_movemask_epi8(ok) != 0xffff) {
+			break;
+		}
+		__m128i packed = _mm_packs_epi32(_mm_sub_epi32(a, bias), _mm_sub_epi32(b, bias));
+		_mm_storeu_si128((__m128i *)(p_dst + i), _mm_xor_si128(packed, unbias));
+	}
+#elif defined(USTRING_SIMD_NEON)
+	for (; i + 8 <= p_len; i += 8) {
+		uint32x4_t a = vld1q_u32((const uint32_t *)(p_src + i));
+		uint32x4_t b = vld1q_u32((const uint32_t *)(p_src + i + 4));
+		if (vmaxvq_u32(vmaxq_u32(a, b)) >= 0xd800) {
+			break;
+		}
+		vst1q_u16(p_dst + i, vcombine_u16(vmovn_u32(a), vmovn_u32(b)));
+	}
+#endif
+	for (; i < p_len && uint32_t(p_src[i]) < 0xd800; i++) {
+		p_dst[i] = p_src[i];
+	}
+	return i;
+}
+
+// Index of the first occurrence of p_char in [p_from, p_to), or -1.
+static _FORCE_INLINE_ int _utf32_find_char(const char32_t *p_src, int p_from, int p_to, char32_t p_char) {
+	int i = p_from;
+#if defined(USTRING_SIMD_SSE2)
+	const __m128i needle = _mm_set1_epi32((int)p_char);
+	for (; i + 4 <= p_to; i += 4) {
+		if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(p_src + i)), needle)) != 0) {
+			break;
+		}
+	}
+#elif defined(USTRING_SIMD_NEON)
+	const uint32x4_t needle = vdupq_n_u32(p_char);
+	for (; i + 4 <= p_to; i += 4) {
+		if (vmaxvq_u32(vceqq_u32(vld1q_u32((const uint32_t *)(p_src + i)), needle)) != 0) {
+			break;
+		}
+	}
+#endif
+	for (; i < p_to; i++) {
+		if (p_src[i] == p_char) {
+			return i;
+		}
+	}
+	return -1;
+}
+
 #define MAX_DIGITS 6
 #define UPPERCASE(m_c) (((m_c) >= 'a' && (m_c) <= 'z') ? ((m_c) - ('a' - 'A')) : (m_c))
 #define LOWERCASE(m_c) (((m_c) >= 'A' && (m_c) <= 'Z') ? ((m_c) + ('a' - 'A')) : (m_c))
@@ -464,8 +726,24 @@ void String::operator=(const wchar_t *p_str) {
 }
 
 String String::operator+(const String &p_str) const {
-	String res = *this;
-	res += p_str;
+	if (p_str.is_empty()) {
+		return *this;
+	}
+	if (is_empty()) {
+		return p_str;
+	}
+
+	// Build the result in a single allocation instead of copying *this and growing it.
+	const int lhs_len = length();
+	const int rhs_len = p_str.length();
+
+	String res;
+	res.resize(lhs_len + rhs_len + 1);
+	char32_t *dst = res.ptrw();
+	memcpy(dst, get_data(), lhs_len * sizeof(char32_t));
+	memcpy(dst + lhs_len, p_str.get_data(), rhs_len * sizeof(char32_t));
+	dst[lhs_len + rhs_len] = 0;
+
 	return res;
 }
 
@@ -502,17 +780,13 @@ String &String::operator+=(const String &p_str) {
 	}
 
 	int from = length();
+	int src_len = p_str.length();
 
-	resize(length() + p_str.size());
+	resize(from + src_len + 1);
 
-	const char32_t *src = p_str.get_data();
 	char32_t *dst = ptrw();
-
-	set(length(), 0);
-
-	for (int i = 0; i < p_str.length(); i++) {
-		dst[from + i] = src[i];
-	}
+	memcpy(dst + from, p_str.get_data(), src_len * sizeof(char32_t));
+	dst[from + src_len] = 0;
 
 	return *this;
 }
@@ -534,11 +808,10 @@ String &String::operator+=(const char *p_str) {
 
 	char32_t *dst = ptrw();
 
-	set(length(), 0);
-
 	for (int i = 0; i < src_len; i++) {
 		dst[from + i] = p_str[i];
 	}
+	dst[from + src_len] = 0;
 
 	return *this;
 }
@@ -560,14 +833,17 @@ String &String::operator+=(const char32_t *p_str) {
 }
 
 String &String::operator+=(char32_t p_char) {
-	resize(size() ? size() + 1 : 2);
-	set(length(), 0);
+	const int from = length();
+	resize(from + 2);
+
+	char32_t *dst = ptrw();
 	if ((p_char >= 0xd800 && p_char <= 0xdfff) || (p_char > 0x10ffff)) {
 		print_error("Unicode parsing error: Invalid unicode codepoint " + num_int64(p_char, 16) + ".");
-		set(length() - 1, 0xfffd);
+		dst[from] = 0xfffd;
 	} else {
-		set(length() - 1, p_char);
+		dst[from] = p_char;
 	}
+	dst[from + 1] = 0;
 
 	return *this;
 }
@@ -1790,6 +2066,10 @@ bool String::parse_utf8(const char *p_utf8, int p_len) {
 		}
 	}
 
+	if (p_len < 0) {
+		p_len = strlen(p_utf8);
+	}
+
 	{
 		const char *ptrtmp = p_utf8;
 		const char *ptrtmp_limit = &p_utf8[p_len];
@@ -1798,10 +2078,17 @@ bool String::parse_utf8(const char *p_utf8, int p_len) {
 			if (skip == 0) {
 				uint8_t c = *ptrtmp >= 0 ? *ptrtmp : uint8_t(256 + *ptrtmp);
 
+				if (c < 0x80) {
+					// Skip the whole ASCII run at once.
+					int run = _utf8_ascii_prefix((const uint8_t *)ptrtmp, ptrtmp_limit - ptrtmp);
+					str_size += run;
+					cstr_size += run;
+					ptrtmp += run;
+					continue;
+				}
+
 				/* Determine the number of characters in sequence */
-				if ((c & 0x80) == 0) {
-					skip = 0;
-				} else if ((c & 0xe0) == 0xc0) {
+				if ((c & 0xe0) == 0xc0) {
 					skip = 1;
 				} else if ((c & 0xf0) == 0xe0) {
 					skip = 2;
@@ -1843,12 +2130,18 @@ bool String::parse_utf8(const char *p_utf8, int p_len) {
 	dst[str_size] = 0;
 
 	while (cstr_size) {
+		if ((*p_utf8 & 0x80) == 0) {
+			int run = _utf8_widen_ascii((const uint8_t *)p_utf8, cstr_size, dst);
+			dst += run;
+			cstr_size -= run;
+			p_utf8 += run;
+			continue;
+		}
+
 		int len = 0;
 
 		/* Determine the number of characters in sequence */
-		if ((*p_utf8 & 0x80) == 0) {
-			len = 1;
-		} else if ((*p_utf8 & 0xe0) == 0xc0) {
+		if ((*p_utf8 & 0xe0) == 0xc0) {
 			len = 2;
 		} else if ((*p_utf8 & 0xf0) == 0xe0) {
 			len = 3;
@@ -1871,24 +2164,18 @@ bool String::parse_utf8(const char *p_utf8, int p_len) {
 
 		/* Convert the first character */
 
-		uint32_t unichar = 0;
-
-		if (len == 1) {
-			unichar = *p_utf8;
-		} else {
-			unichar = (0xff >> (len + 1)) & *p_utf8;
+		uint32_t unichar = (0xff >> (len + 1)) & *p_utf8;
 
-			for (int i = 1; i < len; i++) {
-				if ((p_utf8[i] & 0xc0) != 0x80) {
-					_UNICERROR("invalid utf8");
-					return true; //invalid utf8
-				}
-				if (unichar == 0 && i == 2 && ((p_utf8[i] & 0x7f) >> (7 - len)) == 0) {
-					_UNICERROR("invalid utf8 overlong");
-					return true; //no overlong
-				}
-				unichar = (unichar << 6) | (p_utf8[i] & 0x3f);
+		for (int i = 1; i < len; i++) {
+			if ((p_utf8[i] & 0xc0) != 0x80) {
+				_UNICERROR("invalid utf8");
+				return true; //invalid utf8
 			}
+			if (unichar == 0 && i == 2 && ((p_utf8[i] & 0x7f) >> (7 - len)) == 0) {
+				_UNICERROR("invalid utf8 overlong");
+				return true; //no overlong
+			}
+			unichar = (unichar << 6) | (p_utf8[i] & 0x3f);
 		}
 		if (unichar >= 0xd800 && unichar <= 0xdfff) {
 			_UNICERROR("invalid code point");
@@ -1915,7 +2202,9 @@ CharString String::utf8() const {
 	for (int i = 0; i < l; i++) {
 		uint32_t c = d[i];
 		if (c <= 0x7f) { // 7 bits.
-			fl += 1;
+			int run = _utf32_prefix_below(d + i, l - i, 0x80);
+			fl += run;
+			i += run - 1;
 		} else if (c <= 0x7ff) { // 11 bits
 			fl += 2;
 		} else if (c <= 0xffff) { // 16 bits
@@ -1946,7 +2235,9 @@ CharString String::utf8() const {
 		uint32_t c = d[i];
 
 		if (c <= 0x7f) { // 7 bits.
-			APPEND_CHAR(c);
+			int run = _utf32_narrow_ascii(d + i, l - i, cdst);
+			cdst += run;
+			i += run - 1;
 		} else if (c <= 0x7ff) { // 11 bits
 			APPEND_CHAR(uint32_t(0xc0 | ((c >> 6) & 0x1f))); // Top 5 bits.
 			APPEND_CHAR(uint32_t(0x80 | (c & 0x3f))); // Bottom 6 bits.
@@ -2005,12 +2296,27 @@ bool String::parse_utf16(const char16_t *p_utf16, int p_len) {
 		}
 	}
 
+	if (p_len < 0) {
+		p_len = 0;
+		while (p_utf16[p_len]) {
+			p_len++;
+		}
+	}
+
 	{
 		const char16_t *ptrtmp = p_utf16;
 		const char16_t *ptrtmp_limit = &p_utf16[p_len];
 		int skip = 0;
 		while (ptrtmp != ptrtmp_limit && *ptrtmp) {
 			uint32_t c = (byteswap) ? BSWAP16(*ptrtmp) : *ptrtmp;
+			if (skip == 0 && !byteswap && (c & 0xfffff800) != 0xd800) {
+				// Skip the whole run of single unit characters at once.
+				int run = _utf16_single_prefix(ptrtmp, ptrtmp_limit - ptrtmp);
+				str_size += run;
+				cstr_size += run;
+				ptrtmp += run;
+				continue;
+			}
 			if (skip == 0) {
 				if ((c & 0xfffffc00) == 0xd800) {
 					skip = 1; // lead surrogate
@@ -2053,6 +2359,14 @@ bool String::parse_utf16(const char16_t *p_utf16, int p_len) {
 		int len = 0;
 		uint32_t c = (byteswap) ? BSWAP16(*p_utf16) : *p_utf16;
 
+		if (!byteswap && (c & 0xfffff800) != 0xd800) {
+			int run = _utf16_widen_single(p_utf16, cstr_size, dst);
+			dst += run;
+			cstr_size -= run;
+			p_utf16 += run;
+			continue;
+		}
+
 		if ((c & 0xfffffc00) == 0xd800) {
 			len = 2;
 		} else {
@@ -2091,6 +2405,12 @@ Char16String String::utf16() const {
 	int fl = 0;
 	for (int i = 0; i < l; i++) {
 		uint32_t c = d[i];
+		if (c < 0xd800) { // 16 bits, below the surrogate range.
+			int run = _utf32_prefix_below(d + i, l - i, 0xd800);
+			fl += run;
+			i += run - 1;
+			continue;
+		}
 		if (c <= 0xffff) { // 16 bits.
 			fl += 1;
 		} else if (c <= 0x10ffff) { // 32 bits.
@@ -2118,7 +2438,11 @@ Char16String String::utf16() const {
 	for (int i = 0; i < l; i++) {
 		uint32_t c = d[i];
 
-		if (c <= 0xffff) { // 16 bits.
+		if (c < 0xd800) { // 16 bits, below the surrogate range.
+			int run = _utf32_narrow_single(d + i, l - i, cdst);
+			cdst += run;
+			i += run - 1;
+		} else if (c <= 0xffff) { // 16 bits.
 			APPEND_CHAR(c);
 		} else { // 32 bits.
 			APPEND_CHAR(uint32_t((c >> 10) + 0xd7c0)); // lead surrogate.
@@ -2861,18 +3185,18 @@ int String::find(const String &p_str, int p_from) const {
 
 	const char32_t *src = get_data();
 	const char32_t *str = p_str.get_data();
+	const int last = len - src_len;
 
-	for (int i = p_from; i <= (len - src_len); i++) {
-		bool found = true;
-		for (int j = 0; j < src_len; j++) {
-			int read_pos = i + j;
-
-			if (read_pos >= len) {
-				ERR_PRINT("read_pos>=len");
-				return -1;
-			}
+	for (int i = p_from; i <= last; i++) {
+		// Jump straight to the next candidate position.
+		i = _utf32_find_char(src, i, last + 1, str[0]);
+		if (i < 0) {
+			break;
+		}
 
-			if (src[read_pos] != str[j]) {
+		bool found = true;
+		for (int j = 1; j < src_len; j++) {
+			if (src[i + j] != str[j]) {
 				found = false;
 				break;
 			}
@@ -2904,35 +3228,29 @@ int String::find(const char *p_str, int p_from) const {
 		src_len++;
 	}
 
-	if (src_len == 1) {
-		const char32_t needle = p_str[0];
-
-		for (int i = p_from; i < len; i++) {
-			if (src[i] == needle) {
-				return i;
-			}
-		}
+	if (src_len == 0) {
+		return p_from <= len ? p_from : -1;
+	}
 
-	} else {
-		for (int i = p_from; i <= (len - src_len); i++) {
-			bool found = true;
-			for (int j = 0; j < src_len; j++) {
-				int read_pos = i + j;
+	const int last = len - src_len;
 
-				if (read_pos >= len) {
-					ERR_PRINT("read_pos>=len");
-					return -1;
-				}
+	for (int i = p_from; i <= last; i++) {
+		// Jump straight to the next candidate position.
+		i = _utf32_find_char(src, i, last + 1, (char32_t)p_str[0]);
+		if (i < 0) {
+			break;
+		}
 
-				if (src[read_pos] != (char32_t)p_str[j]) {
-					found = false;
-					break;
-				}
+		bool found = true;
+		for (int j = 1; j < src_len; j++) {
+			if (src[i + j] != (char32_t)p_str[j]) {
+				found = false;
+				break;
 			}
+		}
 
-			if (found) {
-				return i;
-			}
+		if (found) {
+			return i;
 		}
 	}
 
@@ -272,13 +272,43 @@ Error CowData<T>::resize(int p_size) {
 		return OK;
 	}
 
-	// possibly changing size, copy on write
-	uint32_t rc = _copy_on_write();
-
 	size_t current_alloc_size = _get_alloc_size(current_size);
 	size_t alloc_size;
 	ERR_FAIL_COND_V(!_get_alloc_size_checked(p_size, &alloc_size), ERR_OUT_OF_MEMORY);
 
+	// possibly changing size, copy on write
+	uint32_t rc = 0;
+	if (_ptr && _get_refcount()->get() > 1) {
+		// In use by more than me: copy straight into a buffer of the new size,
+		// rather than duplicating the old one and then reallocating it.
+		uint32_t copy_size = MIN(current_size, p_size);
+
+		uint32_t *mem_new = (uint32_t *)Memory::alloc_static(alloc_size, true);
+		ERR_FAIL_COND_V(!mem_new, ERR_OUT_OF_MEMORY);
+
+		new (mem_new - 2, sizeof(uint32_t), "") SafeNumeric<uint32_t>(1); //refcount
+		*(mem_new - 1) = copy_size; //size
+
+		T *_data = (T *)(mem_new);
+
+		if (__has_trivial_copy(T)) {
+			memcpy(mem_new, _ptr, copy_size * sizeof(T));
+		} else {
+			for (uint32_t i = 0; i < copy_size; i++) {
+				memnew_placement(&_data[i], T(_get_data()[i]));
+			}
+		}
+
+		_unref(_ptr);
+		_ptr = _data;
+
+		rc = 1;
+		current_size = copy_size;
+		current_alloc_size = alloc_size;
+	} else if (_ptr) {
+		rc = _get_refcount()->get();
+	}
+
 	if (p_size > current_size) {
 		if (alloc_size != current_alloc_size) {
 			if (current_size == 0) {
@@ -99,6 +99,67 @@ public:
 			p_elem->_root = nullptr;
 		}
 
+		// Stable merge sort, relinking the elements in place.
+		template <class C>
+		void sort_custom() {
+			if (_first == _last) {
+				return;
+			}
+
+			C less;
+			SelfList<T> *list = _first;
+			for (int size = 1;; size *= 2) {
+				SelfList<T> *p = list;
+				SelfList<T> *tail = nullptr;
+				list = nullptr;
+				int merges = 0;
+
+				while (p) {
+					merges++;
+					SelfList<T> *q = p;
+					int p_size = 0;
+					for (int i = 0; i < size && q; i++) {
+						p_size++;
+						q = q->_next;
+					}
+					int q_size = size;
+
+					while (p_size > 0 || (q_size > 0 && q)) {
+						SelfList<T> *e;
+						if (p_size == 0) {
+							e = q;
+							q = q->_next;
+							q_size--;
+						} else if (q_size == 0 || !q || !less(q->_self, p->_self)) {
+							e = p;
+							p = p->_next;
+							p_size--;
+						} else {
+							e = q;
+							q = q->_next;
+							q_size--;
+						}
+
+						if (tail) {
+							tail->_next = e;
+						} else {
+							list = e;
+						}
+						e->_prev = tail;
+						tail = e;
+					}
+					p = q;
+				}
+
+				tail->_next = nullptr;
+				if (merges <= 1) {
+					_first = list;
+					_last = tail;
+					return;
+				}
+			}
+		}
+
 		_FORCE_INLINE_ SelfList<T> *first() { return _first; }
 		_FORCE_INLINE_ const SelfList<T> *first() const { return _first; }
 
@@ -36,7 +36,9 @@
 #include "core/templates/hashfuncs.h"
 #include "core/templates/vector.h"
 #include "core/variant/callable.h"
+#include "core/variant/type_info.h"
 #include "core/variant/variant.h"
+#include "core/variant/variant_internal.h"
 
 class ArrayPrivate {
 public:
@@ -200,7 +202,111 @@ void Array::append_array(const Array &p_array) {
 }
 
 Error Array::resize(int p_new_size) {
-	return _p->array.resize(p_new_size);
+	int old_size = _p->array.size();
+	Error err = _p->array.resize(p_new_size);
+	if (err != OK || p_new_size <= old_size) {
+		return err;
+	}
+
+	// Typed arrays of builtin types are filled with values of that type, not nil.
+	Variant::Type type = _p->typed.type;
+	if (type != Variant::NIL && type != Variant::OBJECT) {
+		Variant value;
+		Callable::CallError ce;
+		Variant::construct(type, value, nullptr, 0, ce);
+
+		Variant *w = _p->array.ptrw();
+		for (int i = old_size; i < p_new_size; i++) {
+			w[i] = value;
+		}
+	}
+	return OK;
+}
+
+struct _ArrayVariantSort {
+	_FORCE_INLINE_ bool operator()(const Variant &p_l, const Variant &p_r) const {
+		bool valid = false;
+		Variant res;
+		Variant::evaluate(Variant::OP_LESS, p_l, p_r, res, valid);
+		if (!valid) {
+			res = false;
+		}
+		return res;
+	}
+};
+
+// Typed arrays of numbers compare their values directly instead of evaluating Variant operators.
+// Writes through operator[] are not validated, so the type of each value is checked before reading it.
+
+template <class T>
+_FORCE_INLINE_ static bool _is_typed(const Variant &p_variant) {
+	return p_variant.get_type() == GetTypeInfo<T>::VARIANT_TYPE;
+}
+
+template <class T>
+_FORCE_INLINE_ static const T &_typed_value(const Variant &p_variant) {
+	return *VariantGetInternalPtr<T>::get_ptr(&p_variant);
+}
+
+template <class T>
+struct _ArrayTypedSort {
+	_FORCE_INLINE_ bool operator()(const Variant &p_l, const Variant &p_r) const {
+		if (likely(_is_typed<T>(p_l) && _is_typed<T>(p_r))) {
+			return _typed_value<T>(p_l) < _typed_value<T>(p_r);
+		}
+		return _ArrayVariantSort()(p_l, p_r);
+	}
+};
+
+template <class T>
+static int _typed_find(const Vector<Variant> &p_array, const Variant &p_value, int p_from, int p_step) {
+	const T value = _typed_value<T>(p_value);
+	const Variant *ptr = p_array.ptr();
+	for (int i = p_from; i >= 0 && i < p_array.size(); i += p_step) {
+		if (likely(_is_typed<T>(ptr[i])) ? _typed_value<T>(ptr[i]) == value : ptr[i] == p_value) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+template <class T>
+static int _typed_count(const Vector<Variant> &p_array, const Variant &p_value) {
+	const T value = _typed_value<T>(p_value);
+	const Variant *ptr = p_array.ptr();
+	int amount = 0;
+	for (int i = 0; i < p_array.size(); i++) {
+		if (likely(_is_typed<T>(ptr[i])) ? _typed_value<T>(ptr[i]) == value : ptr[i] == p_value) {
+			amount++;
+		}
+	}
+	return amount;
+}
+
+// Returns false if a value doesn't have the type of the array, to use Variant operators instead.
+template <class T>
+static bool _typed_min_max(const Vector<Variant> &p_array, bool p_max, Variant &r_ret) {
+	if (p_array.is_empty()) {
+		r_ret = Variant();
+		return true;
+	}
+
+	const Variant *ptr = p_array.ptr();
+	if (!_is_typed<T>(ptr[0])) {
+		return false;
+	}
+	T ret = _typed_value<T>(ptr[0]);
+	for (int i = 1; i < p_array.size(); i++) {
+		if (unlikely(!_is_typed<T>(ptr[i]))) {
+			return false;
+		}
+		const T &value = _typed_value<T>(ptr[i]);
+		if (p_max ? (value > ret) : (value < ret)) {
+			ret = value;
+		}
+	}
+	r_ret = ret;
+	return true;
 }
 
 void Array::insert(int p_pos, const Variant &p_value) {
@@ -230,7 +336,14 @@ Variant Array::back() const {
 
 int Array::find(const Variant &p_value, int p_from) const {
 	ERR_FAIL_COND_V(!_p->typed.validate(p_value, "find"), -1);
-	return _p->array.find(p_value, p_from);
+	switch (_p->typed.type) {
+		case Variant::INT:
+			return _typed_find<int64_t>(_p->array, p_value, p_from, 1);
+		case Variant::FLOAT:
+			return _typed_find<double>(_p->array, p_value, p_from, 1);
+		default:
+			return _p->array.find(p_value, p_from);
+	}
 }
 
 int Array::rfind(const Variant &p_value, int p_from) const {
@@ -248,6 +361,15 @@ int Array::rfind(const Variant &p_value, int p_from) const {
 		p_from = _p->array.size() - 1;
 	}
 
+	switch (_p->typed.type) {
+		case Variant::INT:
+			return _typed_find<int64_t>(_p->array, p_value, p_from, -1);
+		case Variant::FLOAT:
+			return _typed_find<double>(_p->array, p_value, p_from, -1);
+		default:
+			break;
+	}
+
 	for (int i = p_from; i >= 0; i--) {
 		if (_p->array[i] == p_value) {
 			return i;
@@ -268,6 +390,15 @@ int Array::count(const Variant &p_value) const {
 		return 0;
 	}
 
+	switch (_p->typed.type) {
+		case Variant::INT:
+			return _typed_count<int64_t>(_p->array, p_value);
+		case Variant::FLOAT:
+			return _typed_count<double>(_p->array, p_value);
+		default:
+			break;
+	}
+
 	int amount = 0;
 	for (int i = 0; i < _p->array.size(); i++) {
 		if (_p->array[i] == p_value) {
@@ -281,7 +412,7 @@ int Array::count(const Variant &p_value) const {
 bool Array::has(const Variant &p_value) const {
 	ERR_FAIL_COND_V(!_p->typed.validate(p_value, "use 'has'"), false);
 
-	return _p->array.find(p_value, 0) != -1;
+	return find(p_value, 0) != -1;
 }
 
 void Array::remove(int p_pos) {
@@ -434,20 +565,17 @@ Variant Array::reduce(const Callable &p_callable, const Variant &p_accum) const
 	return ret;
 }
 
-struct _ArrayVariantSort {
-	_FORCE_INLINE_ bool operator()(const Variant &p_l, const Variant &p_r) const {
-		bool valid = false;
-		Variant res;
-		Variant::evaluate(Variant::OP_LESS, p_l, p_r, res, valid);
-		if (!valid) {
-			res = false;
-		}
-		return res;
-	}
-};
-
 void Array::sort() {
-	_p->array.sort_custom<_ArrayVariantSort>();
+	switch (_p->typed.type) {
+		case Variant::INT:
+			_p->array.sort_custom<_ArrayTypedSort<int64_t>>();
+			break;
+		case Variant::FLOAT:
+			_p->array.sort_custom<_ArrayTypedSort<double>>();
+			break;
+		default:
+			_p->array.sort_custom<_ArrayVariantSort>();
+	}
 }
 
 struct _ArrayVariantSortCustom {
@@ -512,7 +640,14 @@ _FORCE_INLINE_ int bisect(const Vector<Variant> &p_array, const Variant &p_value
 
 int Array::bsearch(const Variant &p_value, bool p_before) {
 	ERR_FAIL_COND_V(!_p->typed.validate(p_value, "binary search"), -1);
-	return bisect(_p->array, p_value, p_before, _ArrayVariantSort());
+	switch (_p->typed.type) {
+		case Variant::INT:
+			return bisect(_p->array, p_value, p_before, _ArrayTypedSort<int64_t>());
+		case Variant::FLOAT:
+			return bisect(_p->array, p_value, p_before, _ArrayTypedSort<double>());
+		default:
+			return bisect(_p->array, p_value, p_before, _ArrayVariantSort());
+	}
 }
 
 int Array::bsearch_custom(const Variant &p_value, Callable p_callable, bool p_before) {
@@ -553,6 +688,22 @@ Variant Array::pop_front() {
 }
 
 Variant Array::min() const {
+	Variant ret;
+	switch (_p->typed.type) {
+		case Variant::INT:
+			if (_typed_min_max<int64_t>(_p->array, false, ret)) {
+				return ret;
+			}
+			break;
+		case Variant::FLOAT:
+			if (_typed_min_max<double>(_p->array, false, ret)) {
+				return ret;
+			}
+			break;
+		default:
+			break;
+	}
+
 	Variant minval;
 	for (int i = 0; i < size(); i++) {
 		if (i == 0) {
@@ -575,6 +726,22 @@ Variant Array::min() const {
 }
 
 Variant Array::max() const {
+	Variant ret;
+	switch (_p->typed.type) {
+		case Variant::INT:
+			if (_typed_min_max<int64_t>(_p->array, true, ret)) {
+				return ret;
+			}
+			break;
+		case Variant::FLOAT:
+			if (_typed_min_max<double>(_p->array, true, ret)) {
+				return ret;
+			}
+			break;
+		default:
+			break;
+	}
+
 	Variant maxval;
 	for (int i = 0; i < size(); i++) {
 		if (i == 0) {
@@ -35,10 +35,15 @@
 #include "core/string/string_name.h"
 #include "core/templates/list.h"
 
+#include <type_traits>
+
 class Object;
 class Variant;
 class CallableCustom;
 
+template <class T>
+struct VariantCallArg;
+
 // This is an abstraction of things that can be called.
 // It is used for signals and other cases where efficient calling of functions
 // is required. It is designed for the standard case (object and method)
@@ -69,6 +74,8 @@ public:
 
 	void call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, CallError &r_call_error) const;
 	void call_deferred(const Variant **p_arguments, int p_argcount) const;
+	template <class... VarArgs, class = typename std::enable_if<(VariantCallArg<VarArgs>::valid && ...)>::type>
+	void call_deferred(const VarArgs &...p_args) const; // Defined in variant.h.
 
 	void rpc(int p_id, const Variant **p_arguments, int p_argcount, CallError &r_call_error) const;
 
@@ -50,6 +50,8 @@
 #include "core/variant/callable.h"
 #include "core/variant/dictionary.h"
 
+#include <type_traits>
+
 class Object;
 class Node; // helper
 class Control; // helper
@@ -688,6 +690,51 @@ struct VariantComparator {
 	static _FORCE_INLINE_ bool compare(const Variant &p_lhs, const Variant &p_rhs) { return p_lhs.hash_compare(p_rhs); }
 };
 
+// Argument types accepted by the variadic call helpers (Object::call(),
+// MessageQueue::push_call(), etc.). Raw pointers are only taken for strings and
+// objects, so a `const Variant **` argument list never converts to a bool.
+template <class T>
+struct VariantCallArg {
+	typedef typename std::decay<T>::type Type;
+	typedef typename std::remove_cv<typename std::remove_pointer<Type>::type>::type Pointee;
+
+	static constexpr bool valid = std::is_convertible<Type, Variant>::value &&
+			(!std::is_pointer<Type>::value || std::is_same<Pointee, char>::value || std::is_same<Pointee, char32_t>::value || std::is_base_of<Object, Pointee>::value);
+};
+
+#define VARIANT_CALL_ARGS_ENABLE(m_args) class = typename std::enable_if<(VariantCallArg<m_args>::valid && ...)>::type
+
+// Converts a fixed number of arguments to Variants on the stack, so the
+// variadic helpers don't construct unused NIL arguments or scan for them.
+template <int N>
+class VariantCallArgs {
+	Variant args[N];
+	const Variant *argptrs[N];
+
+public:
+	_FORCE_INLINE_ const Variant **get() { return argptrs; }
+
+	template <class... VarArgs>
+	_FORCE_INLINE_ VariantCallArgs(const VarArgs &...p_args) :
+			args{ Variant(p_args)... } {
+		for (int i = 0; i < N; i++) {
+			argptrs[i] = &args[i];
+		}
+	}
+};
+
+template <>
+class VariantCallArgs<0> {
+public:
+	_FORCE_INLINE_ const Variant **get() { return nullptr; }
+};
+
+template <class... VarArgs, class>
+void Callable::call_deferred(const VarArgs &...p_args) const {
+	VariantCallArgs<sizeof...(p_args)> args(p_args...);
+	call_deferred(args.get(), sizeof...(p_args));
+}
+
 Variant::ObjData &Variant::_get_obj() {
 	return *reinterpret_cast<ObjData *>(&_data._mem[0]);
 }
@@ -34,42 +34,84 @@
 #include "core/io/resource_loader.h"
 #include "core/os/keyboard.h"
 #include "core/string/string_buffer.h"
+#include "core/templates/local_vector.h"
 
-char32_t VariantParser::StreamFile::get_char() {
-	return f->get_8();
+void VariantParser::Stream::_fill_readahead() {
+	readahead_pointer = 0;
+	readahead_filled = _read_buffer(readahead_buffer, readahead_enabled ? READAHEAD_SIZE : 1);
+	eof = readahead_filled == 0;
+}
+
+bool VariantParser::Stream::is_eof() const {
+	if (readahead_enabled) {
+		return eof;
+	}
+	return _is_eof();
+}
+
+uint32_t VariantParser::StreamFile::_read_buffer(char32_t *p_buffer, uint32_t p_num_chars) {
+	// Read the bytes into the start of the buffer, then widen them in place.
+	// Going backwards, each character is written at or past the bytes still to be widened.
+	uint8_t *bytes = (uint8_t *)p_buffer;
+	uint64_t num_read = f->get_buffer(bytes, p_num_chars);
+	for (int64_t i = int64_t(num_read) - 1; i >= 0; i--) {
+		p_buffer[i] = bytes[i];
+	}
+	return num_read;
 }
 
 bool VariantParser::StreamFile::is_utf8() const {
 	return true;
 }
 
-bool VariantParser::StreamFile::is_eof() const {
+bool VariantParser::StreamFile::_is_eof() const {
 	return f->eof_reached();
 }
 
-char32_t VariantParser::StreamString::get_char() {
-	if (pos > s.length()) {
-		return 0;
-	} else if (pos == s.length()) {
-		// You need to try to read again when you have reached the end for EOF to be reported,
-		// so this works the same as files (like StreamFile does)
-		pos++;
-		return 0;
-	} else {
-		return s[pos++];
+uint32_t VariantParser::StreamString::_read_buffer(char32_t *p_buffer, uint32_t p_num_chars) {
+	int available = MAX(s.length() - pos, 0);
+	uint32_t num_read = MIN(uint32_t(available), p_num_chars);
+	if (num_read > 0) {
+		memcpy(p_buffer, s.ptr() + pos, num_read * sizeof(char32_t));
 	}
+	// Read past the end once more, so EOF is reported the same way as for files.
+	pos += num_read ? num_read : 1;
+	return num_read;
 }
 
 bool VariantParser::StreamString::is_utf8() const {
 	return false;
 }
 
-bool VariantParser::StreamString::is_eof() const {
+bool VariantParser::StreamString::_is_eof() const {
 	return pos > s.length();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+static void _append_utf8(LocalVector<char> &r_str, char32_t p_char) {
+	if ((p_char & 0xfffff800) == 0xd800) {
+		// Unpaired surrogates can't be encoded in UTF-8.
+		p_char = 0xfffd;
+	}
+
+	if (p_char <= 0x7f) {
+		r_str.push_back(p_char);
+	} else if (p_char <= 0x7ff) {
+		r_str.push_back(0xc0 | ((p_char >> 6) & 0x1f));
+		r_str.push_back(0x80 | (p_char & 0x3f));
+	} else if (p_char <= 0xffff) {
+		r_str.push_back(0xe0 | ((p_char >> 12) & 0x0f));
+		r_str.push_back(0x80 | ((p_char >> 6) & 0x3f));
+		r_str.push_back(0x80 | (p_char & 0x3f));
+	} else {
+		r_str.push_back(0xf0 | ((p_char >> 18) & 0x07));
+		r_str.push_back(0x80 | ((p_char >> 12) & 0x3f));
+		r_str.push_back(0x80 | ((p_char >> 6) & 0x3f));
+		r_str.push_back(0x80 | (p_char & 0x3f));
+	}
+}
+
 const char *VariantParser::tk_name[TK_MAX] = {
 	"'{'",
 	"'}'",
@@ -202,10 +244,24 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 				[[fallthrough]];
 			}
 			case '"': {
+				// File streams deliver raw UTF-8 bytes, collect them and decode them once at the end.
+				const bool utf8 = p_stream->is_utf8();
+				LocalVector<char> utf8_str;
 				String str;
+				// First half of a surrogate pair written as two \u escapes, waiting for the second half.
+				char32_t lead_surrogate = 0;
 				while (true) {
 					char32_t ch = p_stream->get_char();
 
+					if (lead_surrogate && ch != '\\') {
+						if (utf8) {
+							_append_utf8(utf8_str, lead_surrogate);
+						} else {
+							str += lead_surrogate;
+						}
+						lead_surrogate = 0;
+					}
+
 					if (ch == 0) {
 						r_err_str = "Unterminated String";
 						r_token.type = TK_ERROR;
@@ -276,18 +332,41 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 							} break;
 						}
 
-						str += res;
+						if (lead_surrogate) {
+							if (next == 'u' && (res & 0xfffffc00) == 0xdc00) {
+								res = (lead_surrogate << 10UL) + res - ((0xd800 << 10UL) + 0xdc00 - 0x10000);
+							} else if (utf8) {
+								_append_utf8(utf8_str, lead_surrogate);
+							} else {
+								str += lead_surrogate;
+							}
+							lead_surrogate = 0;
+						}
+						if (next == 'u' && (res & 0xfffffc00) == 0xd800) {
+							lead_surrogate = res;
+							continue;
+						}
+
+						if (utf8) {
+							_append_utf8(utf8_str, res);
+						} else {
+							str += res;
+						}
 
 					} else {
 						if (ch == '\n') {
 							line++;
 						}
-						str += ch;
+						if (utf8) {
+							utf8_str.push_back(ch);
+						} else {
+							str += ch;
+						}
 					}
 				}
 
-				if (p_stream->is_utf8()) {
-					str.parse_utf8(str.ascii(true).get_data());
+				if (utf8 && utf8_str.size() > 0) {
+					str.parse_utf8(utf8_str.ptr(), utf8_str.size());
 				}
 				if (string_name) {
 					r_token.type = TK_STRING_NAME;
@@ -439,6 +518,24 @@ Error VariantParser::_parse_enginecfg(Stream *p_stream, Vector<String> &strings,
 	}
 }
 
+static char32_t _skip_whitespace(VariantParser::Stream *p_stream, int &line) {
+	while (true) {
+		char32_t c;
+		if (p_stream->saved) {
+			c = p_stream->saved;
+			p_stream->saved = 0;
+		} else {
+			c = p_stream->get_char();
+		}
+
+		if (c == '\n') {
+			line++;
+		} else if (c > 32 || c == 0) {
+			return c;
+		}
+	}
+}
+
 template <class T>
 Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct, int &line, String &r_err_str) {
 	Token token;
@@ -448,30 +545,94 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 		return ERR_PARSE_ERROR;
 	}
 
+	// Packed arrays can hold millions of numbers, so plain numbers are read
+	// straight from the stream instead of going through a Token each.
+	LocalVector<T> values;
+	char num[64];
+
 	bool first = true;
 	while (true) {
-		if (!first) {
-			get_token(p_stream, token, line, r_err_str);
-			if (token.type == TK_COMMA) {
-				//do none
-			} else if (token.type == TK_PARENTHESIS_CLOSE) {
-				break;
+		char32_t c = _skip_whitespace(p_stream, line);
+
+		if (first && c == ')') {
+			break;
+		}
+
+		if (c == '-' || (c >= '0' && c <= '9')) {
+			int len = 0;
+			if (c == '-') {
+				num[len++] = c;
+				c = p_stream->get_char();
+			}
+
+			// Same grammar as the tokenizer: digits, then an optional fraction and an optional signed exponent.
+			bool digits = false;
+			bool fraction = false;
+			bool exponent = false;
+			bool exponent_sign = false;
+			bool exponent_digits = false;
+			while (true) {
+				if (c >= '0' && c <= '9') {
+					if (exponent) {
+						exponent_digits = true;
+					} else {
+						digits = true;
+					}
+				} else if (c == '.' && !fraction && !exponent) {
+					fraction = true;
+				} else if (c == 'e' && !exponent) {
+					exponent = true;
+				} else if ((c == '-' || c == '+') && exponent && !exponent_sign && !exponent_digits) {
+					exponent_sign = true;
+				} else {
+					break;
+				}
+
+				if (len == sizeof(num) - 1) {
+					r_err_str = "Number too long in constructor";
+					return ERR_PARSE_ERROR;
+				}
+				num[len++] = c;
+				c = p_stream->get_char();
+			}
+			num[len] = 0;
+			p_stream->saved = c;
+
+			if (!digits || (exponent && !exponent_digits)) {
+				r_err_str = "Malformed number in constructor: '" + String(num) + "'";
+				return ERR_PARSE_ERROR;
+			}
+
+			if (fraction || exponent) {
+				values.push_back(T(String::to_float(num)));
 			} else {
-				r_err_str = "Expected ',' or ')' in constructor";
+				values.push_back(T(String::to_int(num, len)));
+			}
+		} else {
+			// Anything else goes through the tokenizer, which also reports errors.
+			p_stream->saved = c;
+			get_token(p_stream, token, line, r_err_str);
+			if (token.type != TK_NUMBER) {
+				r_err_str = "Expected float in constructor";
 				return ERR_PARSE_ERROR;
 			}
+			values.push_back(token.value);
 		}
-		get_token(p_stream, token, line, r_err_str);
+		first = false;
 
-		if (first && token.type == TK_PARENTHESIS_CLOSE) {
+		c = _skip_whitespace(p_stream, line);
+		if (c == ')') {
 			break;
-		} else if (token.type != TK_NUMBER) {
-			r_err_str = "Expected float in constructor";
+		} else if (c != ',') {
+			r_err_str = "Expected ',' or ')' in constructor";
 			return ERR_PARSE_ERROR;
 		}
+	}
 
-		r_construct.push_back(token.value);
-		first = false;
+	r_construct.resize(values.size());
+	T *w = r_construct.ptrw();
+	for (uint32_t i = 0; i < values.size(); i++) {
+		w[i] = values[i];
 	}
 
 	return OK;
@@ -875,17 +1036,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<uint8_t> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				uint8_t *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedInt32Array" || id == "PackedIntArray" || id == "PoolIntArray" || id == "IntArray") {
 			Vector<int32_t> args;
 			Error err = _parse_construct<int32_t>(p_stream, args, line, r_err_str);
@@ -893,17 +1044,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int32_t> arr;
-			{
-				int32_t len = args.size();
-				arr.resize(len);
-				int32_t *w = arr.ptrw();
-				for (int32_t i = 0; i < len; i++) {
-					w[i] = int32_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedInt64Array") {
 			Vector<int64_t> args;
 			Error err = _parse_construct<int64_t>(p_stream, args, line, r_err_str);
@@ -911,17 +1052,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int64_t> arr;
-			{
-				int64_t len = args.size();
-				arr.resize(len);
-				int64_t *w = arr.ptrw();
-				for (int64_t i = 0; i < len; i++) {
-					w[i] = int64_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat32Array" || id == "PackedRealArray" || id == "PoolRealArray" || id == "FloatArray") {
 			Vector<float> args;
 			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
@@ -929,17 +1060,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<float> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				float *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat64Array") {
 			Vector<double> args;
 			Error err = _parse_construct<double>(p_stream, args, line, r_err_str);
@@ -947,17 +1068,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<double> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				double *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedStringArray" || id == "PoolStringArray" || id == "StringArray") {
 			get_token(p_stream, token, line, r_err_str);
 			if (token.type != TK_PARENTHESIS_OPEN) {
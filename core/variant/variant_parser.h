@@ -38,33 +38,69 @@
 class VariantParser {
 public:
 	struct Stream {
-		virtual char32_t get_char() = 0;
-		virtual bool is_utf8() const = 0;
-		virtual bool is_eof() const = 0;
+	private:
+		enum {
+			READAHEAD_SIZE = 2048
+		};
+
+		char32_t readahead_buffer[READAHEAD_SIZE];
+		uint32_t readahead_pointer = 0;
+		uint32_t readahead_filled = 0;
+		bool eof = false;
+
+		void _fill_readahead();
+
+	protected:
+		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) = 0;
+		virtual bool _is_eof() const = 0;
+
+	public:
+		// When disabled, characters are read one at a time, so the position of
+		// the underlying source always matches what has been parsed so far.
+		bool readahead_enabled = true;
 
 		char32_t saved = 0;
 
+		_FORCE_INLINE_ char32_t get_char() {
+			if (unlikely(readahead_pointer == readahead_filled)) {
+				_fill_readahead();
+				if (eof) {
+					return 0;
+				}
+			}
+			return readahead_buffer[readahead_pointer++];
+		}
+
+		virtual bool is_utf8() const = 0;
+		bool is_eof() const;
+
 		Stream() {}
 		virtual ~Stream() {}
 	};
 
 	struct StreamFile : public Stream {
+	protected:
+		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) override;
+		virtual bool _is_eof() const override;
+
+	public:
 		FileAccess *f = nullptr;
 
-		virtual char32_t get_char();
-		virtual bool is_utf8() const;
-		virtual bool is_eof() const;
+		virtual bool is_utf8() const override;
 
 		StreamFile() {}
 	};
 
 	struct StreamString : public Stream {
+	protected:
+		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) override;
+		virtual bool _is_eof() const override;
+
+	public:
 		String s;
 		int pos = 0;
 
-		virtual char32_t get_char();
-		virtual bool is_utf8() const;
-		virtual bool is_eof() const;
+		virtual bool is_utf8() const override;
 
 		StreamString() {}
 	};
@@ -77,6 +77,16 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PHYSICS_3D_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(PHYSICS_3D_ISLAND_COUNT);
 	BIND_ENUM_CONSTANT(AUDIO_OUTPUT_LATENCY);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_INTEGRATE_FORCES_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_GENERATE_ISLANDS_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_SETUP_CONSTRAINTS_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_SOLVE_CONSTRAINTS_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_2D_INTEGRATE_VELOCITIES_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_INTEGRATE_FORCES_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_GENERATE_ISLANDS_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_SETUP_CONSTRAINTS_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_SOLVE_CONSTRAINTS_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_INTEGRATE_VELOCITIES_TIME);
 
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
@@ -120,6 +130,16 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"physics_3d/collision_pairs",
 		"physics_3d/islands",
 		"audio/driver/output_latency",
+		"physics_2d/integrate_forces_time",
+		"physics_2d/generate_islands_time",
+		"physics_2d/setup_constraints_time",
+		"physics_2d/solve_constraints_time",
+		"physics_2d/integrate_velocities_time",
+		"physics_3d/integrate_forces_time",
+		"physics_3d/generate_islands_time",
+		"physics_3d/setup_constraints_time",
+		"physics_3d/solve_constraints_time",
+		"physics_3d/integrate_velocities_time",
 
 	};
 
@@ -182,6 +202,26 @@ float Performance::get_monitor(Monitor p_monitor) const {
 			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_ISLAND_COUNT);
 		case AUDIO_OUTPUT_LATENCY:
 			return AudioServer::get_singleton()->get_output_latency();
+		case PHYSICS_2D_INTEGRATE_FORCES_TIME:
+			return USEC_TO_SEC(PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_INTEGRATE_FORCES_TIME));
+		case PHYSICS_2D_GENERATE_ISLANDS_TIME:
+			return USEC_TO_SEC(PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_GENERATE_ISLANDS_TIME));
+		case PHYSICS_2D_SETUP_CONSTRAINTS_TIME:
+			return USEC_TO_SEC(PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_SETUP_CONSTRAINTS_TIME));
+		case PHYSICS_2D_SOLVE_CONSTRAINTS_TIME:
+			return USEC_TO_SEC(PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_SOLVE_CONSTRAINTS_TIME));
+		case PHYSICS_2D_INTEGRATE_VELOCITIES_TIME:
+			return USEC_TO_SEC(PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_INTEGRATE_VELOCITIES_TIME));
+		case PHYSICS_3D_INTEGRATE_FORCES_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_INTEGRATE_FORCES_TIME));
+		case PHYSICS_3D_GENERATE_ISLANDS_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_GENERATE_ISLANDS_TIME));
+		case PHYSICS_3D_SETUP_CONSTRAINTS_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_SETUP_CONSTRAINTS_TIME));
+		case PHYSICS_3D_SOLVE_CONSTRAINTS_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_SOLVE_CONSTRAINTS_TIME));
+		case PHYSICS_3D_INTEGRATE_VELOCITIES_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_INTEGRATE_VELOCITIES_TIME));
 
 		default: {
 		}
@@ -221,6 +261,16 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
 
 	};
 
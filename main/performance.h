@@ -91,6 +91,16 @@ public:
 		PHYSICS_3D_ISLAND_COUNT,
 		//physics
 		AUDIO_OUTPUT_LATENCY,
+		PHYSICS_2D_INTEGRATE_FORCES_TIME,
+		PHYSICS_2D_GENERATE_ISLANDS_TIME,
+		PHYSICS_2D_SETUP_CONSTRAINTS_TIME,
+		PHYSICS_2D_SOLVE_CONSTRAINTS_TIME,
+		PHYSICS_2D_INTEGRATE_VELOCITIES_TIME,
+		PHYSICS_3D_INTEGRATE_FORCES_TIME,
+		PHYSICS_3D_GENERATE_ISLANDS_TIME,
+		PHYSICS_3D_SETUP_CONSTRAINTS_TIME,
+		PHYSICS_3D_SOLVE_CONSTRAINTS_TIME,
+		PHYSICS_3D_INTEGRATE_VELOCITIES_TIME,
 		MONITOR_MAX
 	};
 
@@ -203,6 +203,24 @@ real_t BulletPhysicsServer3D::space_get_param(RID p_space, SpaceParameter p_para
 	return space->get_param(p_param);
 }
 
+void BulletPhysicsServer3D::space_set_deterministic(RID p_space, bool p_deterministic) {
+	SpaceBullet *space = space_owner.getornull(p_space);
+	ERR_FAIL_COND(!space);
+	ERR_FAIL_COND_MSG(p_deterministic, "Deterministic mode is not supported by the Bullet physics engine.");
+}
+
+bool BulletPhysicsServer3D::space_is_deterministic(RID p_space) const {
+	return false;
+}
+
+Vector<uint8_t> BulletPhysicsServer3D::space_save_snapshot(RID p_space) {
+	ERR_FAIL_V_MSG(Vector<uint8_t>(), "Space snapshots are not supported by the Bullet physics engine.");
+}
+
+Error BulletPhysicsServer3D::space_restore_snapshot(RID p_space, const Vector<uint8_t> &p_snapshot) {
+	ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "Space snapshots are not supported by the Bullet physics engine.");
+}
+
 PhysicsDirectSpaceState3D *BulletPhysicsServer3D::space_get_direct_state(RID p_space) {
 	SpaceBullet *space = space_owner.getornull(p_space);
 	ERR_FAIL_COND_V(!space, nullptr);
@@ -112,6 +112,12 @@ public:
 	/// Not supported
 	virtual real_t space_get_param(RID p_space, SpaceParameter p_param) const override;
 
+	virtual void space_set_deterministic(RID p_space, bool p_deterministic) override;
+	virtual bool space_is_deterministic(RID p_space) const override;
+
+	virtual Vector<uint8_t> space_save_snapshot(RID p_space) override;
+	virtual Error space_restore_snapshot(RID p_space, const Vector<uint8_t> &p_snapshot) override;
+
 	virtual PhysicsDirectSpaceState3D *space_get_direct_state(RID p_space) override;
 
 	virtual void space_set_debug_contacts(RID p_space, int p_max_contacts) override;
@@ -114,6 +114,10 @@ Transform BulletPhysicsDirectBodyState3D::get_transform() const {
 	return body->get_transform();
 }
 
+Transform BulletPhysicsDirectBodyState3D::get_previous_transform() const {
+	return body->get_previous_transform();
+}
+
 void BulletPhysicsDirectBodyState3D::add_central_force(const Vector3 &p_force) {
 	body->apply_central_force(p_force);
 }
@@ -370,6 +374,7 @@ void RigidBodyBullet::dispatch_callbacks() {
 	btBody->setAngularVelocity(btBody->getAngularVelocity() * btBody->getAngularFactor());
 
 	previousActiveState = btBody->isActive();
+	previous_transform = get_transform();
 }
 
 void RigidBodyBullet::set_force_integration_callback(const Callable &p_callable, const Variant &p_udata) {
@@ -557,6 +562,9 @@ void RigidBodyBullet::set_state(PhysicsServer3D::BodyState p_state, const Varian
 	switch (p_state) {
 		case PhysicsServer3D::BODY_STATE_TRANSFORM:
 			set_transform(p_variant);
+			if (mode != PhysicsServer3D::BODY_MODE_KINEMATIC) {
+				previous_transform = get_transform(); // Teleported, nothing to interpolate from.
+			}
 			break;
 		case PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY:
 			set_linear_velocity(p_variant);
@@ -109,6 +109,7 @@ public:
 
 	virtual void set_transform(const Transform &p_transform) override;
 	virtual Transform get_transform() const override;
+	virtual Transform get_previous_transform() const override;
 
 	virtual void add_central_force(const Vector3 &p_force) override;
 	virtual void add_force(const Vector3 &p_force, const Vector3 &p_position = Vector3()) override;
@@ -221,6 +222,7 @@ private:
 	bool isScratchedSpaceOverrideModificator = false;
 
 	bool previousActiveState = true; // Last check state
+	Transform previous_transform;
 
 	ForceIntegrationCallback *force_integration_callback = nullptr;
 
@@ -312,6 +314,8 @@ public:
 	virtual void set_transform__bullet(const btTransform &p_global_transform);
 	virtual const btTransform &get_transform__bullet() const;
 
+	_FORCE_INLINE_ const Transform &get_previous_transform() const { return previous_transform; }
+
 	virtual void reload_shapes();
 
 	virtual void on_enter_area(AreaBullet *p_area);
@@ -779,6 +779,11 @@ void GDScriptByteCodeGenerator::write_get_member(const Address &p_target, const
 	append(p_name);
 }
 
+void GDScriptByteCodeGenerator::write_mark_member_changed(const StringName &p_name) {
+	append(GDScriptFunction::OPCODE_MARK_MEMBER_CHANGED, 0);
+	append(p_name);
+}
+
 void GDScriptByteCodeGenerator::write_assign_with_conversion(const Address &p_target, const Address &p_source) {
 	switch (p_target.type.kind) {
 		case GDScriptDataType::BUILTIN: {
@@ -1003,6 +1003,12 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 					gen->write_set_member(assigned, assign_property);
 				}
 
+				// Members typed as builtin values are modified in place, so report the change.
+				// Untyped members may hold objects, which stay the same when only the object changed.
+				if (base.mode == GDScriptCodeGenerator::Address::MEMBER && base.type.has_type && base.type.kind == GDScriptDataType::BUILTIN && base.type.builtin_type != Variant::OBJECT) {
+					gen->write_mark_member_changed(static_cast<const GDScriptParser::IdentifierNode *>(chain.back()->get()->base)->name);
+				}
+
 				if (assigned.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
 					gen->pop_temporary();
 				}
@@ -1089,6 +1095,9 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 					} else {
 						gen->write_assign(target, op_result);
 					}
+					if (target.mode == GDScriptCodeGenerator::Address::MEMBER) {
+						gen->write_mark_member_changed(static_cast<const GDScriptParser::IdentifierNode *>(assignment->assignee)->name);
+					}
 				}
 
 				if (op_result.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
@@ -268,6 +268,14 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 3;
 			} break;
+			case OPCODE_MARK_MEMBER_CHANGED: {
+				text += "mark_member_changed ";
+				text += "[\"";
+				text += _global_names_ptr[_code_ptr[ip + 1]];
+				text += "\"]";
+
+				incr += 2;
+			} break;
 			case OPCODE_GET_MEMBER: {
 				text += "get_member ";
 				text += DADDR(1);
@@ -32,6 +32,7 @@
 #define GDSCRIPT_TEST_RUNNER_SUITE_H
 
 #include "gdscript_test_runner.h"
+#include "scene/main/node.h"
 #include "tests/test_macros.h"
 
 namespace GDScriptTests {
@@ -69,6 +70,53 @@ func _init():
 	CHECK_MESSAGE(int(reference->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
 
+TEST_CASE("[Modules][GDScript] Member assignments are reported as property changes") {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(R"(
+extends Node
+
+var health = 10
+var offset := Vector2()
+
+func hit():
+	health -= 1
+
+func move():
+	offset.x = 2.0
+
+func prioritize():
+	process_priority = 3
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The script should parse successfully.");
+
+	Node *node = memnew(Node);
+	node->set_script(gdscript);
+	node->set_track_property_changes(true);
+
+	List<StringName> changed;
+	node->call("hit");
+	node->get_changed_properties(&changed);
+	REQUIRE(changed.size() == 1);
+	CHECK_MESSAGE(changed.back()->get() == "health", "Script members assigned inside the script should be reported.");
+
+	changed.clear();
+	node->call("move");
+	node->get_changed_properties(&changed);
+	REQUIRE(changed.size() == 2);
+	CHECK_MESSAGE(changed.back()->get() == "offset", "Script members modified in place should be reported.");
+
+	changed.clear();
+	node->call("prioritize");
+	node->get_changed_properties(&changed);
+	REQUIRE(changed.size() == 3);
+	CHECK_MESSAGE(changed.back()->get() == "process_priority", "Built-in properties assigned inside the script should be reported.");
+
+	memdelete(node);
+}
+
 } // namespace GDScriptTests
 
 #endif // GDSCRIPT_TEST_RUNNER_SUITE_H
@@ -36,7 +36,7 @@
 void CollisionObject2D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ENTER_TREE: {
-			Transform2D global_transform = get_global_transform();
+			Transform2D global_transform = _get_physics_transform();
 
 			if (area) {
 				PhysicsServer2D::get_singleton()->area_set_transform(rid, global_transform);
@@ -72,7 +72,7 @@ void CollisionObject2D::_notification(int p_what) {
 				return;
 			}
 
-			Transform2D global_transform = get_global_transform();
+			Transform2D global_transform = _get_physics_transform();
 
 			if (area) {
 				PhysicsServer2D::get_singleton()->area_set_transform(rid, global_transform);
@@ -71,6 +71,10 @@ protected:
 	static void _bind_methods();
 
 	void _update_pickable();
+
+	// Transform given to the physics server, differs from the global transform while drawn interpolated.
+	virtual Transform2D _get_physics_transform() const { return get_global_transform(); }
+
 	friend class Viewport;
 	void _input_event(Node *p_viewport, const Ref<InputEvent> &p_input_event, int p_shape);
 	void _mouse_enter();
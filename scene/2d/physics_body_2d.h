@@ -157,15 +157,29 @@ private:
 	};
 
 	ContactMonitor *contact_monitor = nullptr;
+
+	// Transforms of the last physics step, drawn interpolated when physics interpolation is enabled.
+	Transform2D interpolation_from;
+	Transform2D interpolation_to;
+	uint64_t interpolation_physics_frame = 0;
+	// While drawn interpolated, the physics transform relative to the drawn one.
+	Transform2D interpolation_offset;
+	bool interpolated = false;
+
 	void _body_enter_tree(ObjectID p_id);
 	void _body_exit_tree(ObjectID p_id);
 
+	void _set_drawn_transform(const Transform2D &p_xform);
+	void _restore_physics_transform();
+	void _update_interpolated_transform();
 	void _body_inout(int p_status, const RID &p_body, ObjectID p_instance, int p_body_shape, int p_local_shape);
 	void _direct_state_changed(Object *p_state);
 
 	bool _test_motion(const Vector2 &p_motion, bool p_infinite_inertia = true, real_t p_margin = 0.08, const Ref<PhysicsTestMotionResult2D> &p_result = Ref<PhysicsTestMotionResult2D>());
 
 protected:
+	virtual Transform2D _get_physics_transform() const override;
+
 	void _notification(int p_what);
 	static void _bind_methods();
 
@@ -84,6 +84,9 @@ protected:
 
 	void _on_transform_changed();
 
+	// Transform given to the physics server, differs from the global transform while drawn interpolated.
+	virtual Transform _get_physics_transform() const { return get_global_transform(); }
+
 	friend class Viewport;
 	virtual void _input_event(Node *p_camera, const Ref<InputEvent> &p_input_event, const Vector3 &p_pos, const Vector3 &p_normal, int p_shape);
 	virtual void _mouse_enter();
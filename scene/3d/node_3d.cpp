@@ -73,17 +73,28 @@ future: no idea
 Node3DGizmo::Node3DGizmo() {
 }
 
-void Node3D::_notify_dirty() {
+bool Node3D::_wants_transform_notification() const {
 #ifdef TOOLS_ENABLED
-	if ((data.gizmo.is_valid() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
+	return data.gizmo.is_valid() || data.notify_transform;
 #else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
-
+	return data.notify_transform;
 #endif
+}
+
+void Node3D::_notify_dirty() {
+	if (_wants_transform_notification() && !data.ignore_notification && !xform_change.in_list()) {
 		get_tree()->xform_change_list.add(&xform_change);
 	}
 }
 
+void Node3D::_clear_subtree_dirty() {
+	// A node being cleared in a subtree means its parents can't skip it anymore.
+	data.subtree_dirty = false;
+	for (Node3D *p = data.parent; p && p->data.subtree_dirty; p = p->data.parent) {
+		p->data.subtree_dirty = false;
+	}
+}
+
 void Node3D::_update_local_transform() const {
 	data.local_transform.basis.set_euler_scale(data.rotation, data.scale);
 
@@ -95,27 +106,27 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
-	/*
-	if (data.dirty&DIRTY_GLOBAL)
-		return; //already dirty
-	*/
+	// Being globally dirty is not enough to stop here, as notifications may
+	// have been sent (or ignored) since. Only skip fully handled subtrees, so
+	// moving many nodes of a hierarchy in a frame doesn't walk it again and again.
+	if (data.subtree_dirty) {
+		return;
+	}
 
 	data.children_lock++;
 
+	bool subtree_dirty = true;
 	for (List<Node3D *>::Element *E = data.children.front(); E; E = E->next()) {
 		if (E->get()->data.top_level_active) {
 			continue; //don't propagate to a top_level
 		}
 		E->get()->_propagate_transform_changed(p_origin);
+		subtree_dirty = subtree_dirty && E->get()->data.subtree_dirty;
 	}
-#ifdef TOOLS_ENABLED
-	if ((data.gizmo.is_valid() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
-#else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
-#endif
-		get_tree()->xform_change_list.add(&xform_change);
-	}
+
+	_notify_dirty();
 	data.dirty |= DIRTY_GLOBAL;
+	data.subtree_dirty = subtree_dirty && (xform_change.in_list() || !_wants_transform_notification());
 
 	data.children_lock--;
 }
@@ -145,6 +156,7 @@ void Node3D::_notification(int p_what) {
 			}
 
 			data.dirty |= DIRTY_GLOBAL; //global is always dirty upon entering a scene
+			_clear_subtree_dirty(); // Not propagated to this node by the parent.
 			_notify_dirty();
 
 			notification(NOTIFICATION_ENTER_WORLD);
@@ -155,6 +167,7 @@ void Node3D::_notification(int p_what) {
 			if (xform_change.in_list()) {
 				get_tree()->xform_change_list.remove(&xform_change);
 			}
+			data.subtree_dirty = false;
 			if (data.C) {
 				data.parent->data.children.erase(data.C);
 			}
@@ -211,6 +224,8 @@ void Node3D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
+			// No longer queued, so it must be queued again on the next change.
+			_clear_subtree_dirty();
 #ifdef TOOLS_ENABLED
 			if (data.gizmo.is_valid()) {
 				data.gizmo->transform();
@@ -268,6 +283,7 @@ Transform Node3D::get_global_transform() const {
 		}
 
 		data.dirty &= ~DIRTY_GLOBAL;
+		data.subtree_dirty = false; // Parents were updated (and cleared) first.
 	}
 
 	return data.global_transform;
@@ -400,6 +416,7 @@ void Node3D::set_gizmo(const Ref<Node3DGizmo> &p_gizmo) {
 		data.gizmo->free();
 	}
 	data.gizmo = p_gizmo;
+	_clear_subtree_dirty();
 	if (data.gizmo.is_valid() && is_inside_world()) {
 		data.gizmo->create();
 		if (is_visible_in_tree()) {
@@ -468,6 +485,7 @@ void Node3D::set_as_top_level(bool p_enabled) {
 
 		data.top_level = p_enabled;
 		data.top_level_active = p_enabled;
+		_clear_subtree_dirty();
 
 	} else {
 		data.top_level = p_enabled;
@@ -668,6 +686,7 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 
 void Node3D::set_notify_transform(bool p_enable) {
 	data.notify_transform = p_enable;
+	_clear_subtree_dirty();
 }
 
 bool Node3D::is_transform_notification_enabled() const {
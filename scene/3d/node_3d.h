@@ -68,6 +68,9 @@ class Node3D : public Node {
 		mutable Vector3 scale = Vector3(1, 1, 1);
 
 		mutable int dirty = DIRTY_NONE;
+		// This node and its subtree (except top level nodes) are globally dirty,
+		// and those which want transform notifications are queued for them.
+		mutable bool subtree_dirty = false;
 
 		Viewport *viewport = nullptr;
 
@@ -97,6 +100,8 @@ class Node3D : public Node {
 
 	void _update_gizmo();
 	void _notify_dirty();
+	_FORCE_INLINE_ bool _wants_transform_notification() const;
+	void _clear_subtree_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
 
 	void _propagate_visibility_changed();
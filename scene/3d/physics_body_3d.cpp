@@ -281,8 +281,18 @@ void RigidBody3D::_direct_state_changed(Object *p_state) {
 	state = (PhysicsDirectBodyState3D *)p_state; //trust it
 #endif
 
+	interpolated = false;
+	interpolation_offset = Transform();
 	set_ignore_transform_notification(true);
 	set_global_transform(state->get_transform());
+	if (Engine::get_singleton()->is_physics_interpolation_enabled()) {
+		interpolation_from = state->get_previous_transform();
+		interpolation_to = state->get_transform();
+		interpolation_physics_frame = Engine::get_singleton()->get_physics_frames();
+		set_notify_local_transform(true);
+		set_process_internal(true);
+		set_physics_process_internal(true);
+	}
 	linear_velocity = state->get_linear_velocity();
 	angular_velocity = state->get_angular_velocity();
 	inverse_inertia_tensor = state->get_inverse_inertia_tensor();
@@ -378,7 +388,75 @@ void RigidBody3D::_direct_state_changed(Object *p_state) {
 	state = nullptr;
 }
 
+Transform RigidBody3D::_get_physics_transform() const {
+	if (interpolated) {
+		return get_global_transform() * interpolation_offset;
+	}
+	return get_global_transform();
+}
+
+void RigidBody3D::_set_drawn_transform(const Transform &p_xform) {
+	applying_interpolation = true;
+	set_ignore_transform_notification(true);
+	set_global_transform(p_xform);
+	set_ignore_transform_notification(false);
+	applying_interpolation = false;
+	_on_transform_changed();
+}
+
+void RigidBody3D::_restore_physics_transform() {
+	if (!interpolated) {
+		return;
+	}
+
+	Transform xform = _get_physics_transform();
+	interpolated = false;
+	interpolation_offset = Transform();
+	_set_drawn_transform(xform);
+}
+
+void RigidBody3D::_update_interpolated_transform() {
+	const Engine *engine = Engine::get_singleton();
+	if (!engine->is_physics_interpolation_enabled() || engine->get_physics_frames() > interpolation_physics_frame + 1) {
+		// Not moved by the last physics step, stay at the physics transform until the next one.
+		_restore_physics_transform();
+		interpolation_from = interpolation_to;
+		set_process_internal(false);
+		set_physics_process_internal(false);
+		return;
+	}
+
+	// Only the drawn transform is interpolated, the physics server and scripts keep seeing the physics one.
+	Transform xform = interpolation_from.interpolate_with(interpolation_to, engine->get_physics_interpolation_fraction());
+	interpolation_offset = xform.affine_inverse() * interpolation_to;
+	interpolated = true;
+	_set_drawn_transform(xform);
+}
+
 void RigidBody3D::_notification(int p_what) {
+	if (p_what == NOTIFICATION_INTERNAL_PROCESS) {
+		_update_interpolated_transform();
+	}
+
+	if (p_what == NOTIFICATION_INTERNAL_PHYSICS_PROCESS) {
+		// Runs before scripts' physics processing, which must see the physics transform.
+		_restore_physics_transform();
+	}
+
+	if (p_what == NOTIFICATION_LOCAL_TRANSFORM_CHANGED && !applying_interpolation) {
+		// Moved from script, the new transform is the physics one.
+		interpolated = false;
+		interpolation_offset = Transform();
+	}
+
+	if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+		// Moved outside of physics, don't interpolate from the old location.
+		// The physics server already received the physics transform, drop the drawn one.
+		_restore_physics_transform();
+		interpolation_from = get_global_transform();
+		interpolation_to = interpolation_from;
+	}
+
 #ifdef TOOLS_ENABLED
 	if (p_what == NOTIFICATION_ENTER_TREE) {
 		if (Engine::get_singleton()->is_editor_hint()) {
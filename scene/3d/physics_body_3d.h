@@ -154,11 +154,25 @@ protected:
 	};
 
 	ContactMonitor *contact_monitor = nullptr;
+
+	// Transforms of the last physics step, drawn interpolated when physics interpolation is enabled.
+	Transform interpolation_from;
+	Transform interpolation_to;
+	uint64_t interpolation_physics_frame = 0;
+	// While drawn interpolated, the physics transform relative to the drawn one.
+	Transform interpolation_offset;
+	bool interpolated = false;
+	bool applying_interpolation = false;
+
 	void _body_enter_tree(ObjectID p_id);
 	void _body_exit_tree(ObjectID p_id);
 
+	void _set_drawn_transform(const Transform &p_xform);
+	void _restore_physics_transform();
+	void _update_interpolated_transform();
 	void _body_inout(int p_status, const RID &p_body, ObjectID p_instance, int p_body_shape, int p_local_shape);
 	virtual void _direct_state_changed(Object *p_state);
+	virtual Transform _get_physics_transform() const override;
 
 	void _notification(int p_what);
 	static void _bind_methods();
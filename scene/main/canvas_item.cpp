@@ -474,6 +474,7 @@ Transform2D CanvasItem::get_global_transform() const {
 		}
 
 		global_invalid = false;
+		subtree_dirty = false; // Parents were updated (and cleared) first.
 	}
 
 	return global_transform;
@@ -582,6 +583,7 @@ void CanvasItem::_notification(int p_what) {
 				}
 			}
 			_enter_canvas();
+			_clear_subtree_dirty(); // Not propagated to this item by the parent.
 			if (!block_transform_notify && !xform_change.in_list()) {
 				get_tree()->xform_change_list.add(&xform_change);
 			}
@@ -613,9 +615,13 @@ void CanvasItem::_notification(int p_what) {
 				window->disconnect(SceneStringNames::get_singleton()->visibility_changed, callable_mp(this, &CanvasItem::_window_visibility_changed));
 			}
 			global_invalid = true;
+			subtree_dirty = false;
+		} break;
+		case NOTIFICATION_DRAW: {
 		} break;
-		case NOTIFICATION_DRAW:
 		case NOTIFICATION_TRANSFORM_CHANGED: {
+			// No longer queued, so it must be queued again on the next change.
+			_clear_subtree_dirty();
 		} break;
 		case NOTIFICATION_VISIBILITY_CHANGED: {
 			emit_signal(SceneStringNames::get_singleton()->visibility_changed);
@@ -681,6 +687,7 @@ void CanvasItem::set_as_top_level(bool p_top_level) {
 	top_level = p_top_level;
 	_enter_canvas();
 
+	_clear_subtree_dirty();
 	_notify_transform();
 }
 
@@ -927,14 +934,22 @@ real_t CanvasItem::draw_char(const Ref<Font> &p_font, const Point2 &p_pos, const
 	return p_font->draw_char(canvas_item, p_pos, p_char[0], p_next.get_data()[0], p_size, p_modulate, p_outline_size, p_outline_modulate);
 }
 
+void CanvasItem::_clear_subtree_dirty() {
+	// An item being cleared in a subtree means its parents can't skip it anymore.
+	subtree_dirty = false;
+	for (CanvasItem *p = get_parent_item(); p && p->subtree_dirty; p = p->get_parent_item()) {
+		p->subtree_dirty = false;
+	}
+}
+
 void CanvasItem::_notify_transform(CanvasItem *p_node) {
 	/* This check exists to avoid re-propagating the transform
-	 * notification down the tree on dirty nodes. It provides
-	 * optimization by avoiding redundancy (nodes are dirty, will get the
-	 * notification anyway).
+	 * notification down the tree on dirty nodes. Being globally invalid
+	 * is not enough to stop here, as notifications may have been sent
+	 * since. Only skip fully handled subtrees.
 	 */
 
-	if (/*p_node->xform_change.in_list() &&*/ p_node->global_invalid) {
+	if (p_node->subtree_dirty) {
 		return; //nothing to do
 	}
 
@@ -948,13 +963,17 @@ void CanvasItem::_notify_transform(CanvasItem *p_node) {
 		}
 	}
 
+	bool subtree_dirty = true;
 	for (List<CanvasItem *>::Element *E = p_node->children_items.front(); E; E = E->next()) {
 		CanvasItem *ci = E->get();
 		if (ci->top_level) {
 			continue;
 		}
 		_notify_transform(ci);
+		subtree_dirty = subtree_dirty && ci->subtree_dirty;
 	}
+
+	p_node->subtree_dirty = subtree_dirty && (p_node->xform_change.in_list() || !p_node->notify_transform);
 }
 
 Rect2 CanvasItem::get_viewport_rect() const {
@@ -1286,6 +1305,7 @@ void CanvasItem::set_notify_transform(bool p_enable) {
 	}
 
 	notify_transform = p_enable;
+	_clear_subtree_dirty();
 
 	if (notify_transform && is_inside_tree()) {
 		//this ensures that invalid globals get resolved, so notifications can be received
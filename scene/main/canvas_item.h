@@ -221,6 +221,9 @@ private:
 
 	mutable Transform2D global_transform;
 	mutable bool global_invalid = true;
+	// This item and its subtree (except top level items) have an invalid global
+	// transform, and those which want transform notifications are queued for them.
+	mutable bool subtree_dirty = false;
 
 	void _top_level_raise_self();
 
@@ -234,6 +237,7 @@ private:
 	void _window_visibility_changed();
 
 	void _notify_transform(CanvasItem *p_node);
+	void _clear_subtree_dirty();
 
 	void _set_on_top(bool p_on_top) { set_draw_behind_parent(!p_on_top); }
 	bool _is_on_top() const { return !is_draw_behind_parent_enabled(); }
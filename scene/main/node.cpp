@@ -211,6 +211,11 @@ void Node::_propagate_enter_tree() {
 		E->get().group = data.tree->add_to_group(E->key(), this);
 	}
 
+	_update_process_list(SceneTree::PROCESS_LIST_PROCESS, data.process);
+	_update_process_list(SceneTree::PROCESS_LIST_PHYSICS_PROCESS, data.physics_process);
+	_update_process_list(SceneTree::PROCESS_LIST_PROCESS_INTERNAL, data.process_internal);
+	_update_process_list(SceneTree::PROCESS_LIST_PHYSICS_PROCESS_INTERNAL, data.physics_process_internal);
+
 	notification(NOTIFICATION_ENTER_TREE);
 
 	if (get_script_instance()) {
@@ -284,6 +289,11 @@ void Node::_propagate_exit_tree() {
 		data.tree->tree_changed();
 	}
 
+	_update_process_list(SceneTree::PROCESS_LIST_PROCESS, false);
+	_update_process_list(SceneTree::PROCESS_LIST_PHYSICS_PROCESS, false);
+	_update_process_list(SceneTree::PROCESS_LIST_PROCESS_INTERNAL, false);
+	_update_process_list(SceneTree::PROCESS_LIST_PHYSICS_PROCESS_INTERNAL, false);
+
 	data.inside_tree = false;
 	data.ready_notified = false;
 	data.tree = nullptr;
@@ -291,6 +301,7 @@ void Node::_propagate_exit_tree() {
 }
 
 void Node::move_child(Node *p_child, int p_pos) {
+	ERR_PROCESS_THREAD_GUARD;
 	ERR_FAIL_NULL(p_child);
 	ERR_FAIL_INDEX_MSG(p_pos, data.children.size() + 1, "Invalid new child position: " + itos(p_pos) + ".");
 	ERR_FAIL_COND_MSG(p_child->data.parent != this, "Child is not a child of this node.");
@@ -331,6 +342,9 @@ void Node::move_child(Node *p_child, int p_pos) {
 			E->get().group->changed = true;
 		}
 	}
+	if (p_child->data.inside_tree) {
+		p_child->_mark_process_lists_changed();
+	}
 
 	data.blocked--;
 }
@@ -355,18 +369,40 @@ void Node::move_child_notify(Node *p_child) {
 	// to be used when not wanted
 }
 
-void Node::set_physics_process(bool p_process) {
-	if (data.physics_process == p_process) {
+void Node::_update_process_list(SceneTree::ProcessListType p_list, bool p_enabled) {
+	if (!data.inside_tree) {
 		return;
 	}
 
-	data.physics_process = p_process;
+	bool *in_list = &data.in_process_list[p_list];
+	if (*in_list == p_enabled) {
+		return;
+	}
+	*in_list = p_enabled;
 
-	if (data.physics_process) {
-		add_to_group("physics_process", false);
+	if (p_enabled) {
+		data.tree->add_to_process_list(p_list, this);
 	} else {
-		remove_from_group("physics_process");
+		data.tree->remove_from_process_list(p_list, this);
+	}
+}
+
+void Node::_mark_process_lists_changed() {
+	for (int i = 0; i < SceneTree::PROCESS_LIST_MAX; i++) {
+		if (data.in_process_list[i]) {
+			data.tree->make_process_list_changed(SceneTree::ProcessListType(i));
+		}
+	}
+}
+
+void Node::set_physics_process(bool p_process) {
+	ERR_PROCESS_THREAD_GUARD;
+	if (data.physics_process == p_process) {
+		return;
 	}
+
+	data.physics_process = p_process;
+	_update_process_list(SceneTree::PROCESS_LIST_PHYSICS_PROCESS, data.physics_process);
 }
 
 bool Node::is_physics_processing() const {
@@ -374,17 +410,13 @@ bool Node::is_physics_processing() const {
 }
 
 void Node::set_physics_process_internal(bool p_process_internal) {
+	ERR_PROCESS_THREAD_GUARD;
 	if (data.physics_process_internal == p_process_internal) {
 		return;
 	}
 
 	data.physics_process_internal = p_process_internal;
-
-	if (data.physics_process_internal) {
-		add_to_group("physics_process_internal", false);
-	} else {
-		remove_from_group("physics_process_internal");
-	}
+	_update_process_list(SceneTree::PROCESS_LIST_PHYSICS_PROCESS_INTERNAL, data.physics_process_internal);
 }
 
 bool Node::is_physics_processing_internal() const {
@@ -392,6 +424,7 @@ bool Node::is_physics_processing_internal() const {
 }
 
 void Node::set_process_mode(ProcessMode p_mode) {
+	ERR_PROCESS_THREAD_GUARD;
 	if (data.process_mode == p_mode) {
 		return;
 	}
@@ -888,17 +921,13 @@ float Node::get_process_delta_time() const {
 }
 
 void Node::set_process(bool p_process) {
+	ERR_PROCESS_THREAD_GUARD;
 	if (data.process == p_process) {
 		return;
 	}
 
 	data.process = p_process;
-
-	if (data.process) {
-		add_to_group("process", false);
-	} else {
-		remove_from_group("process");
-	}
+	_update_process_list(SceneTree::PROCESS_LIST_PROCESS, data.process);
 }
 
 bool Node::is_processing() const {
@@ -906,17 +935,13 @@ bool Node::is_processing() const {
 }
 
 void Node::set_process_internal(bool p_process_internal) {
+	ERR_PROCESS_THREAD_GUARD;
 	if (data.process_internal == p_process_internal) {
 		return;
 	}
 
 	data.process_internal = p_process_internal;
-
-	if (data.process_internal) {
-		add_to_group("process_internal", false);
-	} else {
-		remove_from_group("process_internal");
-	}
+	_update_process_list(SceneTree::PROCESS_LIST_PROCESS_INTERNAL, data.process_internal);
 }
 
 bool Node::is_processing_internal() const {
@@ -924,34 +949,30 @@ bool Node::is_processing_internal() const {
 }
 
 void Node::set_process_priority(int p_priority) {
+	ERR_PROCESS_THREAD_GUARD;
 	data.process_priority = p_priority;
 
 	// Make sure we are in SceneTree.
-	if (data.tree == nullptr) {
+	if (!data.inside_tree) {
 		return;
 	}
 
-	if (is_processing()) {
-		data.tree->make_group_changed("process");
-	}
-
-	if (is_processing_internal()) {
-		data.tree->make_group_changed("process_internal");
-	}
-
-	if (is_physics_processing()) {
-		data.tree->make_group_changed("physics_process");
-	}
-
-	if (is_physics_processing_internal()) {
-		data.tree->make_group_changed("physics_process_internal");
-	}
+	_mark_process_lists_changed();
 }
 
 int Node::get_process_priority() const {
 	return data.process_priority;
 }
 
+void Node::set_process_threaded(bool p_threaded) {
+	ERR_PROCESS_THREAD_GUARD;
+	data.process_threaded = p_threaded;
+}
+
+bool Node::is_process_threaded() const {
+	return data.process_threaded;
+}
+
 void Node::set_process_input(bool p_enable) {
 	if (p_enable == data.input) {
 		return;
@@ -1018,17 +1039,30 @@ StringName Node::get_name() const {
 }
 
 void Node::_set_name_nocheck(const StringName &p_name) {
+	if (data.parent) {
+		data.parent->_child_name_map_remove(this);
+	}
 	data.name = p_name;
+	if (data.parent) {
+		data.parent->_child_name_map_add(this);
+	}
 }
 
 void Node::set_name(const String &p_name) {
+	ERR_PROCESS_THREAD_GUARD;
 	String name = p_name.validate_node_name();
 
 	ERR_FAIL_COND(name == "");
+
+	if (data.parent) {
+		data.parent->_child_name_map_remove(this);
+	}
+
 	data.name = name;
 
 	if (data.parent) {
 		data.parent->_validate_child_name(this);
+		data.parent->_child_name_map_add(this);
 	}
 
 	propagate_notification(NOTIFICATION_PATH_CHANGED);
@@ -1081,18 +1115,7 @@ void Node::_validate_child_name(Node *p_child, bool p_force_human_readable) {
 			unique = false;
 		} else {
 			//check if exists
-			Node **children = data.children.ptrw();
-			int cc = data.children.size();
-
-			for (int i = 0; i < cc; i++) {
-				if (children[i] == p_child) {
-					continue;
-				}
-				if (children[i]->data.name == p_child->data.name) {
-					unique = false;
-					break;
-				}
-			}
+			unique = _get_other_child_by_name(p_child, p_child->data.name) == nullptr;
 		}
 
 		if (!unique) {
@@ -1149,24 +1172,8 @@ void Node::_generate_serial_child_name(const Node *p_child, StringName &name) co
 	}
 
 	//quickly test if proposed name exists
-	int cc = data.children.size(); //children count
-	const Node *const *children_ptr = data.children.ptr();
-
-	{
-		bool exists = false;
-
-		for (int i = 0; i < cc; i++) {
-			if (children_ptr[i] == p_child) { //exclude self in renaming if it's already a child
-				continue;
-			}
-			if (children_ptr[i]->data.name == name) {
-				exists = true;
-			}
-		}
-
-		if (!exists) {
-			return; //if it does not exist, it does not need validation
-		}
+	if (!_get_other_child_by_name(p_child, name)) {
+		return; //if it does not exist, it does not need validation
 	}
 
 	// Extract trailing number
@@ -1193,18 +1200,8 @@ void Node::_generate_serial_child_name(const Node *p_child, StringName &name) co
 
 	for (;;) {
 		StringName attempt = name_string + nums;
-		bool exists = false;
-
-		for (int i = 0; i < cc; i++) {
-			if (children_ptr[i] == p_child) {
-				continue;
-			}
-			if (children_ptr[i]->data.name == attempt) {
-				exists = true;
-			}
-		}
 
-		if (!exists) {
+		if (!_get_other_child_by_name(p_child, attempt)) {
 			name = attempt;
 			return;
 		} else {
@@ -1219,12 +1216,68 @@ void Node::_generate_serial_child_name(const Node *p_child, StringName &name) co
 	}
 }
 
+void Node::_child_name_map_add(Node *p_child) {
+	// Looking up children by name is a linear search, unless there are many of them.
+	if (data.child_name_map.is_empty()) {
+		if (data.children.size() < CHILD_NAME_MAP_MIN_CHILDREN) {
+			return;
+		}
+
+		for (int i = 0; i < data.children.size(); i++) {
+			Node *child = data.children[i];
+			if (!data.child_name_map.has(child->data.name)) {
+				data.child_name_map.set(child->data.name, child);
+			}
+		}
+		return;
+	}
+
+	if (!data.child_name_map.has(p_child->data.name)) {
+		data.child_name_map.set(p_child->data.name, p_child);
+	}
+}
+
+void Node::_child_name_map_remove(Node *p_child) {
+	Node **E = data.child_name_map.getptr(p_child->data.name);
+	if (!E || *E != p_child) {
+		return;
+	}
+
+	// Siblings can briefly share a name (e.g. while renaming), point to the one left if any.
+	for (int i = 0; i < data.children.size(); i++) {
+		Node *child = data.children[i];
+		if (child != p_child && child->data.name == p_child->data.name) {
+			*E = child;
+			return;
+		}
+	}
+	data.child_name_map.erase(p_child->data.name);
+}
+
+Node *Node::_get_other_child_by_name(const Node *p_child, const StringName &p_name) const {
+	if (!data.child_name_map.is_empty()) {
+		Node *const *E = data.child_name_map.getptr(p_name);
+		return E && *E != p_child ? *E : nullptr;
+	}
+
+	int cc = data.children.size();
+	Node *const *cd = data.children.ptr();
+	for (int i = 0; i < cc; i++) {
+		if (cd[i] != p_child && cd[i]->data.name == p_name) {
+			return cd[i];
+		}
+	}
+
+	return nullptr;
+}
+
 void Node::_add_child_nocheck(Node *p_child, const StringName &p_name) {
 	//add a child node quickly, without name validation
 
 	p_child->data.name = p_name;
 	p_child->data.pos = data.children.size();
 	data.children.push_back(p_child);
+	_child_name_map_add(p_child);
 	p_child->data.parent = this;
 	p_child->notification(NOTIFICATION_PARENTED);
 
@@ -1239,6 +1292,7 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name) {
 }
 
 void Node::add_child(Node *p_child, bool p_legible_unique_name) {
+	ERR_PROCESS_THREAD_GUARD;
 	ERR_FAIL_NULL(p_child);
 	ERR_FAIL_COND_MSG(p_child == this, "Can't add child '" + p_child->get_name() + "' to itself."); // adding to itself!
 	ERR_FAIL_COND_MSG(p_child->data.parent, "Can't add child '" + p_child->get_name() + "' to '" + get_name() + "', already has a parent '" + p_child->data.parent->get_name() + "'."); //Fail if node has a parent
@@ -1285,6 +1339,7 @@ void Node::_propagate_validate_owner() {
 }
 
 void Node::remove_child(Node *p_child) {
+	ERR_PROCESS_THREAD_GUARD;
 	ERR_FAIL_NULL(p_child);
 	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, remove_node() failed. Consider using call_deferred(\"remove_child\", child) instead.");
 
@@ -1319,6 +1374,7 @@ void Node::remove_child(Node *p_child) {
 	p_child->notification(NOTIFICATION_UNPARENTED);
 
 	data.children.remove(idx);
+	_child_name_map_remove(p_child);
 
 	//update pointer and size
 	child_count = data.children.size();
@@ -1354,6 +1410,11 @@ Node *Node::get_child(int p_index) const {
 }
 
 Node *Node::_get_child_by_name(const StringName &p_name) const {
+	if (!data.child_name_map.is_empty()) {
+		Node *const *E = data.child_name_map.getptr(p_name);
+		return E ? *E : nullptr;
+	}
+
 	int cc = data.children.size();
 	Node *const *cd = data.children.ptr();
 
@@ -1406,16 +1467,7 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 			}
 
 		} else {
-			next = nullptr;
-
-			for (int j = 0; j < current->data.children.size(); j++) {
-				Node *child = current->data.children[j];
-
-				if (child->data.name == name) {
-					next = child;
-					break;
-				}
-			}
+			next = current->_get_child_by_name(name);
 			if (next == nullptr) {
 				return nullptr;
 			};
@@ -1581,6 +1633,7 @@ void Node::_set_owner_nocheck(Node *p_owner) {
 }
 
 void Node::set_owner(Node *p_owner) {
+	ERR_PROCESS_THREAD_GUARD;
 	if (data.owner) {
 		data.owner->data.owned.erase(data.OW);
 		data.OW = nullptr;
@@ -1723,26 +1776,24 @@ bool Node::is_in_group(const StringName &p_identifier) const {
 }
 
 void Node::add_to_group(const StringName &p_identifier, bool p_persistent) {
+	ERR_PROCESS_THREAD_GUARD;
 	ERR_FAIL_COND(!p_identifier.operator String().length());
 
 	if (data.grouped.has(p_identifier)) {
 		return;
 	}
 
-	GroupData gd;
+	// The tree stores the node's slot in the group data, so it has to exist first.
+	GroupData &gd = data.grouped[p_identifier];
+	gd.persistent = p_persistent;
 
 	if (data.tree) {
 		gd.group = data.tree->add_to_group(p_identifier, this);
-	} else {
-		gd.group = nullptr;
 	}
-
-	gd.persistent = p_persistent;
-
-	data.grouped[p_identifier] = gd;
 }
 
 void Node::remove_from_group(const StringName &p_identifier) {
+	ERR_PROCESS_THREAD_GUARD;
 	ERR_FAIL_COND(!data.grouped.has(p_identifier));
 
 	Map<StringName, GroupData>::Element *E = data.grouped.find(p_identifier);
@@ -2733,6 +2784,8 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_process", "enable"), &Node::set_process);
 	ClassDB::bind_method(D_METHOD("set_process_priority", "priority"), &Node::set_process_priority);
 	ClassDB::bind_method(D_METHOD("get_process_priority"), &Node::get_process_priority);
+	ClassDB::bind_method(D_METHOD("set_process_threaded", "enable"), &Node::set_process_threaded);
+	ClassDB::bind_method(D_METHOD("is_process_threaded"), &Node::is_process_threaded);
 	ClassDB::bind_method(D_METHOD("is_processing"), &Node::is_processing);
 	ClassDB::bind_method(D_METHOD("set_process_input", "enable"), &Node::set_process_input);
 	ClassDB::bind_method(D_METHOD("is_processing_input"), &Node::is_processing_input);
@@ -2874,6 +2927,7 @@ void Node::_bind_methods() {
 	ADD_GROUP("Process", "process_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_mode", PROPERTY_HINT_ENUM, "Inherit,Pausable,When Paused,Always,Disabled"), "set_process_mode", "get_process_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_priority"), "set_process_priority", "get_process_priority");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "process_threaded"), "set_process_threaded", "is_process_threaded");
 
 	ADD_GROUP("Editor Description", "editor_");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "editor_description", PROPERTY_HINT_MULTILINE_TEXT, "", PROPERTY_USAGE_EDITOR | PROPERTY_USAGE_INTERNAL), "set_editor_description", "get_editor_description");
@@ -68,6 +68,10 @@ public:
 		bool operator()(const Node *p_a, const Node *p_b) const { return p_b->is_greater_than(p_a); }
 	};
 
+	struct ComparatorByDepth {
+		bool operator()(const Node *p_a, const Node *p_b) const { return p_a->data.depth < p_b->data.depth; }
+	};
+
 	struct ComparatorWithPriority {
 		bool operator()(const Node *p_a, const Node *p_b) const { return p_b->data.process_priority == p_a->data.process_priority ? p_b->is_greater_than(p_a) : p_b->data.process_priority > p_a->data.process_priority; }
 	};
@@ -78,6 +82,7 @@ private:
 	struct GroupData {
 		bool persistent = false;
 		SceneTree::Group *group = nullptr;
+		uint32_t index = 0; // Slot in the tree's group, valid while inside the tree.
 	};
 
 	struct NetData {
@@ -93,6 +98,7 @@ private:
 		Node *parent = nullptr;
 		Node *owner = nullptr;
 		Vector<Node *> children;
+		HashMap<StringName, Node *> child_name_map; // Only filled with many children, see _child_name_map_add().
 		int pos = -1;
 		int depth = -1;
 		int blocked = 0; // Safeguard that throws an error when attempting to modify the tree in a harmful way while being traversed.
@@ -127,6 +133,11 @@ private:
 
 		bool physics_process_internal = false;
 		bool process_internal = false;
+		bool process_threaded = false;
+
+		// Position in the SceneTree process lists this node is in.
+		bool in_process_list[SceneTree::PROCESS_LIST_MAX] = {};
+		uint32_t process_list_index[SceneTree::PROCESS_LIST_MAX] = {};
 
 		bool input = false;
 		bool unhandled_input = false;
@@ -166,6 +177,8 @@ private:
 	void _propagate_enter_tree();
 	void _propagate_ready();
 	void _propagate_exit_tree();
+	void _update_process_list(SceneTree::ProcessListType p_list, bool p_enabled);
+	void _mark_process_lists_changed();
 	void _propagate_after_exit_tree();
 	void _propagate_validate_owner();
 	void _print_stray_nodes();
@@ -207,6 +220,14 @@ protected:
 
 	friend class SceneState;
 
+	enum {
+		CHILD_NAME_MAP_MIN_CHILDREN = 16,
+	};
+
+	void _child_name_map_add(Node *p_child);
+	void _child_name_map_remove(Node *p_child);
+	Node *_get_other_child_by_name(const Node *p_child, const StringName &p_name) const;
+
 	void _add_child_nocheck(Node *p_child, const StringName &p_name);
 	void _set_owner_nocheck(Node *p_owner);
 	void _set_name_nocheck(const StringName &p_name);
@@ -349,6 +370,9 @@ public:
 	void set_process_priority(int p_priority);
 	int get_process_priority() const;
 
+	void set_process_threaded(bool p_threaded);
+	bool is_process_threaded() const;
+
 	void set_process_input(bool p_enable);
 	bool is_processing_input() const;
 
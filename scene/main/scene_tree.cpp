@@ -98,6 +98,8 @@ void SceneTree::tree_changed() {
 	emit_signal(tree_changed_name);
 }
 
+thread_local bool SceneTree::in_process_thread = false;
+
 void SceneTree::node_added(Node *p_node) {
 	emit_signal(node_added_name, p_node);
 }
@@ -107,9 +109,6 @@ void SceneTree::node_removed(Node *p_node) {
 		current_scene = nullptr;
 	}
 	emit_signal(node_removed_name, p_node);
-	if (call_lock > 0) {
-		call_skip.insert(p_node);
-	}
 }
 
 void SceneTree::node_renamed(Node *p_node) {
@@ -117,36 +116,55 @@ void SceneTree::node_renamed(Node *p_node) {
 }
 
 SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_node) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
-		E = group_map.insert(p_group, Group());
-	}
+	Map<StringName, Node::GroupData>::Element *E = p_node->data.grouped.find(p_group);
+	ERR_FAIL_COND_V(!E, nullptr);
 
-	ERR_FAIL_COND_V_MSG(E->get().nodes.find(p_node) != -1, &E->get(), "Already in group: " + p_group + ".");
-	E->get().nodes.push_back(p_node);
-	//E->get().last_tree_version=0;
-	E->get().changed = true;
-	return &E->get();
+	Group &g = group_map[p_group];
+	E->get().index = g.nodes.size();
+	g.nodes.push_back(p_node);
+	g.changed = true;
+	return &g;
 }
 
 void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
+	Group *g = group_map.getptr(p_group);
+	ERR_FAIL_COND(!g);
+	Map<StringName, Node::GroupData>::Element *E = p_node->data.grouped.find(p_group);
 	ERR_FAIL_COND(!E);
 
-	E->get().nodes.erase(p_node);
-	if (E->get().nodes.is_empty()) {
-		group_map.erase(E);
+	uint32_t index = E->get().index;
+	ERR_FAIL_COND(index >= g->nodes.size() || g->nodes[index] != p_node);
+
+	g->nodes[index] = nullptr;
+	g->erased++;
+	if (g->lock > 0) {
+		return;
+	}
+
+	if (g->erased == g->nodes.size()) {
+		group_map.erase(p_group);
+	} else if (g->erased > g->nodes.size() / 2) {
+		// Groups that are never called would otherwise keep growing with each
+		// add/remove cycle. Compaction keeps the order, so only indices change.
+		_compact_group(*g);
+		for (uint32_t i = 0; i < g->nodes.size(); i++) {
+			g->nodes[i]->data.grouped.find(p_group)->get().index = i;
+		}
 	}
 }
 
 void SceneTree::make_group_changed(const StringName &p_group) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (E) {
-		E->get().changed = true;
+	Group *g = group_map.getptr(p_group);
+	if (g) {
+		g->changed = true;
 	}
 }
 
 void SceneTree::flush_transform_notifications() {
+	// Notify parents before their children, so global transforms are computed
+	// top-down from already updated parents instead of recursing up the tree.
+	xform_change_list.sort_custom<Node::ComparatorByDepth>();
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
@@ -160,16 +178,17 @@ void SceneTree::flush_transform_notifications() {
 void SceneTree::_flush_ugc() {
 	ugc_locked = true;
 
+	LocalVector<const Variant *> argptrs;
 	while (unique_group_calls.size()) {
 		Map<UGCall, Vector<Variant>>::Element *E = unique_group_calls.front();
 
-		Variant v[VARIANT_ARG_MAX];
-		for (int i = 0; i < E->get().size(); i++) {
-			v[i] = E->get()[i];
+		const Vector<Variant> &args = E->get();
+		argptrs.resize(args.size());
+		for (int i = 0; i < args.size(); i++) {
+			argptrs[i] = &args[i];
 		}
 
-		static_assert(VARIANT_ARG_MAX == 5, "This code needs to be updated if VARIANT_ARG_MAX != 5");
-		call_group_flags(GROUP_CALL_REALTIME, E->key().group, E->key().call, v[0], v[1], v[2], v[3], v[4]);
+		call_group_flags(GROUP_CALL_REALTIME, E->key().group, E->key().call, argptrs.ptr(), args.size());
 
 		unique_group_calls.erase(E);
 	}
@@ -177,34 +196,104 @@ void SceneTree::_flush_ugc() {
 	ugc_locked = false;
 }
 
-void SceneTree::_update_group_order(Group &g, bool p_use_priority) {
-	if (!g.changed) {
+void SceneTree::_update_group_order(const StringName &p_name, Group &g) {
+	if (g.lock > 0 || (!g.changed && g.erased == 0)) {
 		return;
 	}
-	if (g.nodes.is_empty()) {
+
+	if (g.erased > 0) {
+		_compact_group(g);
+	}
+
+	if (g.changed) {
+		SortArray<Node *, Node::Comparator> node_sort;
+		node_sort.sort(g.nodes.ptr(), g.nodes.size());
+		g.changed = false;
+	}
+
+	for (uint32_t i = 0; i < g.nodes.size(); i++) {
+		g.nodes[i]->data.grouped.find(p_name)->get().index = i;
+	}
+}
+
+void SceneTree::_compact_group(Group &g) {
+	uint32_t to = 0;
+	for (uint32_t from = 0; from < g.nodes.size(); from++) {
+		if (g.nodes[from]) {
+			g.nodes[to++] = g.nodes[from];
+		}
+	}
+	g.nodes.resize(to);
+	g.erased = 0;
+}
+
+void SceneTree::_unlock_group(const StringName &p_name, Group &g) {
+	g.lock--;
+	if (g.lock == 0 && g.erased == g.nodes.size()) {
+		group_map.erase(p_name);
+	}
+}
+
+void SceneTree::add_to_process_list(ProcessListType p_list, Node *p_node) {
+	Group &pl = process_lists[p_list];
+	p_node->data.process_list_index[p_list] = pl.nodes.size();
+	pl.nodes.push_back(p_node);
+	pl.changed = true;
+}
+
+void SceneTree::remove_from_process_list(ProcessListType p_list, Node *p_node) {
+	Group &pl = process_lists[p_list];
+	uint32_t index = p_node->data.process_list_index[p_list];
+	ERR_FAIL_COND(index >= pl.nodes.size() || pl.nodes[index] != p_node);
+
+	pl.nodes[index] = nullptr;
+	pl.erased++;
+}
+
+void SceneTree::make_process_list_changed(ProcessListType p_list) {
+	process_lists[p_list].changed = true;
+}
+
+void SceneTree::_update_process_list(ProcessListType p_list) {
+	Group &pl = process_lists[p_list];
+	if (!pl.changed && pl.erased == 0) {
 		return;
 	}
 
-	Node **nodes = g.nodes.ptrw();
-	int node_count = g.nodes.size();
+	if (pl.erased > 0) {
+		_compact_group(pl);
+	}
 
-	if (p_use_priority) {
+	if (pl.changed) {
 		SortArray<Node *, Node::ComparatorWithPriority> node_sort;
-		node_sort.sort(nodes, node_count);
-	} else {
-		SortArray<Node *, Node::Comparator> node_sort;
-		node_sort.sort(nodes, node_count);
+		node_sort.sort(pl.nodes.ptr(), pl.nodes.size());
+		pl.changed = false;
+	}
+
+	for (uint32_t i = 0; i < pl.nodes.size(); i++) {
+		pl.nodes[i]->data.process_list_index[p_list] = i;
 	}
-	g.changed = false;
 }
 
 void SceneTree::call_group_flags(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, VARIANT_ARG_DECLARE) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
-		return;
+	VARIANT_ARGPTRS;
+
+	int argc = 0;
+	for (int i = 0; i < VARIANT_ARG_MAX; i++) {
+		if (argptr[i]->get_type() == Variant::NIL) {
+			break;
+		}
+		argc++;
 	}
-	Group &g = E->get();
-	if (g.nodes.is_empty()) {
+
+	call_group_flags(p_call_flags, p_group, p_function, argptr, argc);
+}
+
+void SceneTree::call_group_flags(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
+	ERR_PROCESS_THREAD_GUARD;
+
+	Group *g = group_map.getptr(p_group);
+	if (!g) {
 		return;
 	}
 
@@ -219,161 +308,146 @@ void SceneTree::call_group_flags(uint32_t p_call_flags, const StringName &p_grou
 			return;
 		}
 
-		VARIANT_ARGPTRS;
-
 		Vector<Variant> args;
-		for (int i = 0; i < VARIANT_ARG_MAX; i++) {
-			if (argptr[i]->get_type() == Variant::NIL) {
-				break;
-			}
-			args.push_back(*argptr[i]);
+		args.resize(p_argcount);
+		for (int i = 0; i < p_argcount; i++) {
+			args.write[i] = *p_args[i];
 		}
 
 		unique_group_calls[ug] = args;
 		return;
 	}
 
-	_update_group_order(g);
-
-	Vector<Node *> nodes_copy = g.nodes;
-	Node **nodes = nodes_copy.ptrw();
-	int node_count = nodes_copy.size();
+	_update_group_order(p_group, *g);
 
-	call_lock++;
+	// Nodes added during the calls are appended and not visited, removed ones leave a null slot.
+	int node_count = g->nodes.size();
+	g->lock++;
 
 	if (p_call_flags & GROUP_CALL_REVERSE) {
 		for (int i = node_count - 1; i >= 0; i--) {
-			if (call_lock && call_skip.has(nodes[i])) {
+			Node *n = g->nodes[i];
+			if (!n) {
 				continue;
 			}
 
 			if (p_call_flags & GROUP_CALL_REALTIME) {
-				nodes[i]->call(p_function, VARIANT_ARG_PASS);
+				Callable::CallError ce;
+				n->call(p_function, p_args, p_argcount, ce);
 			} else {
-				MessageQueue::get_singleton()->push_call(nodes[i], p_function, VARIANT_ARG_PASS);
+				MessageQueue::get_singleton()->push_call(n->get_instance_id(), p_function, p_args, p_argcount);
 			}
 		}
 
 	} else {
 		for (int i = 0; i < node_count; i++) {
-			if (call_lock && call_skip.has(nodes[i])) {
+			Node *n = g->nodes[i];
+			if (!n) {
 				continue;
 			}
 
 			if (p_call_flags & GROUP_CALL_REALTIME) {
-				nodes[i]->call(p_function, VARIANT_ARG_PASS);
+				Callable::CallError ce;
+				n->call(p_function, p_args, p_argcount, ce);
 			} else {
-				MessageQueue::get_singleton()->push_call(nodes[i], p_function, VARIANT_ARG_PASS);
+				MessageQueue::get_singleton()->push_call(n->get_instance_id(), p_function, p_args, p_argcount);
 			}
 		}
 	}
 
-	call_lock--;
-	if (call_lock == 0) {
-		call_skip.clear();
-	}
+	_unlock_group(p_group, *g);
 }
 
 void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_group, int p_notification) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
-		return;
-	}
-	Group &g = E->get();
-	if (g.nodes.is_empty()) {
+	ERR_PROCESS_THREAD_GUARD;
+
+	Group *g = group_map.getptr(p_group);
+	if (!g) {
 		return;
 	}
 
-	_update_group_order(g);
+	_update_group_order(p_group, *g);
 
-	Vector<Node *> nodes_copy = g.nodes;
-	Node **nodes = nodes_copy.ptrw();
-	int node_count = nodes_copy.size();
-
-	call_lock++;
+	// Nodes added during the calls are appended and not visited, removed ones leave a null slot.
+	int node_count = g->nodes.size();
+	g->lock++;
 
 	if (p_call_flags & GROUP_CALL_REVERSE) {
 		for (int i = node_count - 1; i >= 0; i--) {
-			if (call_lock && call_skip.has(nodes[i])) {
+			Node *n = g->nodes[i];
+			if (!n) {
 				continue;
 			}
 
 			if (p_call_flags & GROUP_CALL_REALTIME) {
-				nodes[i]->notification(p_notification);
+				n->notification(p_notification);
 			} else {
-				MessageQueue::get_singleton()->push_notification(nodes[i], p_notification);
+				MessageQueue::get_singleton()->push_notification(n, p_notification);
 			}
 		}
 
 	} else {
 		for (int i = 0; i < node_count; i++) {
-			if (call_lock && call_skip.has(nodes[i])) {
+			Node *n = g->nodes[i];
+			if (!n) {
 				continue;
 			}
 
 			if (p_call_flags & GROUP_CALL_REALTIME) {
-				nodes[i]->notification(p_notification);
+				n->notification(p_notification);
 			} else {
-				MessageQueue::get_singleton()->push_notification(nodes[i], p_notification);
+				MessageQueue::get_singleton()->push_notification(n, p_notification);
 			}
 		}
 	}
 
-	call_lock--;
-	if (call_lock == 0) {
-		call_skip.clear();
-	}
+	_unlock_group(p_group, *g);
 }
 
 void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group, const String &p_name, const Variant &p_value) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
-		return;
-	}
-	Group &g = E->get();
-	if (g.nodes.is_empty()) {
+	ERR_PROCESS_THREAD_GUARD;
+
+	Group *g = group_map.getptr(p_group);
+	if (!g) {
 		return;
 	}
 
-	_update_group_order(g);
-
-	Vector<Node *> nodes_copy = g.nodes;
-	Node **nodes = nodes_copy.ptrw();
-	int node_count = nodes_copy.size();
+	_update_group_order(p_group, *g);
 
-	call_lock++;
+	// Nodes added during the calls are appended and not visited, removed ones leave a null slot.
+	int node_count = g->nodes.size();
+	g->lock++;
 
 	if (p_call_flags & GROUP_CALL_REVERSE) {
 		for (int i = node_count - 1; i >= 0; i--) {
-			if (call_lock && call_skip.has(nodes[i])) {
+			Node *n = g->nodes[i];
+			if (!n) {
 				continue;
 			}
 
 			if (p_call_flags & GROUP_CALL_REALTIME) {
-				nodes[i]->set(p_name, p_value);
+				n->set(p_name, p_value);
 			} else {
-				MessageQueue::get_singleton()->push_set(nodes[i], p_name, p_value);
+				MessageQueue::get_singleton()->push_set(n, p_name, p_value);
 			}
 		}
 
 	} else {
 		for (int i = 0; i < node_count; i++) {
-			if (call_lock && call_skip.has(nodes[i])) {
+			Node *n = g->nodes[i];
+			if (!n) {
 				continue;
 			}
 
 			if (p_call_flags & GROUP_CALL_REALTIME) {
-				nodes[i]->set(p_name, p_value);
+				n->set(p_name, p_value);
 			} else {
-				MessageQueue::get_singleton()->push_set(nodes[i], p_name, p_value);
+				MessageQueue::get_singleton()->push_set(n, p_name, p_value);
 			}
 		}
 	}
 
-	call_lock--;
-	if (call_lock == 0) {
-		call_skip.clear();
-	}
+	_unlock_group(p_group, *g);
 }
 
 void SceneTree::call_group(const StringName &p_group, const StringName &p_function, VARIANT_ARG_DECLARE) {
@@ -407,9 +481,9 @@ bool SceneTree::physics_process(float p_time) {
 
 	emit_signal("physics_frame");
 
-	_notify_group_pause("physics_process_internal", Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
+	_notify_process_list(PROCESS_LIST_PHYSICS_PROCESS_INTERNAL, Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
 	call_group_flags(GROUP_CALL_REALTIME, "_viewports", "_process_picking");
-	_notify_group_pause("physics_process", Node::NOTIFICATION_PHYSICS_PROCESS);
+	_notify_process_list(PROCESS_LIST_PHYSICS_PROCESS, Node::NOTIFICATION_PHYSICS_PROCESS);
 	_flush_ugc();
 	MessageQueue::get_singleton()->flush(); //small little hack
 	flush_transform_notifications();
@@ -439,8 +513,8 @@ bool SceneTree::process(float p_time) {
 
 	flush_transform_notifications();
 
-	_notify_group_pause("process_internal", Node::NOTIFICATION_INTERNAL_PROCESS);
-	_notify_group_pause("process", Node::NOTIFICATION_PROCESS);
+	_notify_process_list(PROCESS_LIST_PROCESS_INTERNAL, Node::NOTIFICATION_INTERNAL_PROCESS);
+	_notify_process_list(PROCESS_LIST_PROCESS, Node::NOTIFICATION_PROCESS);
 
 	_flush_ugc();
 	MessageQueue::get_singleton()->flush(); //small little hack
@@ -772,48 +846,68 @@ bool SceneTree::is_paused() const {
 	return paused;
 }
 
-void SceneTree::_notify_group_pause(const StringName &p_group, int p_notification) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
+void SceneTree::_process_node_threaded(uint32_t p_index, Node **p_nodes) {
+	Node *n = p_nodes[p_index];
+	if (!n || !n->can_process()) {
 		return;
 	}
-	Group &g = E->get();
-	if (g.nodes.is_empty()) {
+
+	in_process_thread = true;
+	n->notification(process_thread_notification);
+	in_process_thread = false;
+}
+
+void SceneTree::_notify_process_list(ProcessListType p_list, int p_notification) {
+	Group &pl = process_lists[p_list];
+	if (pl.lock == 0) {
+		_update_process_list(p_list);
+	}
+
+	// Nodes added while processing are appended and wait for the next frame.
+	uint32_t node_count = pl.nodes.size();
+	if (node_count == 0) {
 		return;
 	}
 
-	_update_group_order(g, p_notification == Node::NOTIFICATION_PROCESS || p_notification == Node::NOTIFICATION_INTERNAL_PROCESS || p_notification == Node::NOTIFICATION_PHYSICS_PROCESS || p_notification == Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
+	// Only user processing can be threaded, internal processing is never thread-safe.
+	bool can_thread = p_list == PROCESS_LIST_PROCESS || p_list == PROCESS_LIST_PHYSICS_PROCESS;
 
-	//copy, so copy on write happens in case something is removed from process while being called
-	//performance is not lost because only if something is added/removed the vector is copied.
-	Vector<Node *> nodes_copy = g.nodes;
+	pl.lock++;
 
-	int node_count = nodes_copy.size();
-	Node **nodes = nodes_copy.ptrw();
+	for (uint32_t i = 0; i < node_count; i++) {
+		Node *n = pl.nodes[i];
+		if (!n) {
+			continue; // Removed while processing.
+		}
 
-	call_lock++;
+#ifndef NO_THREADS
+		if (can_thread && n->is_process_threaded()) {
+			// Consecutive threaded nodes (in priority order) are processed together.
+			uint32_t batch_end = i + 1;
+			while (batch_end < node_count && (!pl.nodes[batch_end] || pl.nodes[batch_end]->is_process_threaded())) {
+				batch_end++;
+			}
 
-	for (int i = 0; i < node_count; i++) {
-		Node *n = nodes[i];
-		if (call_lock && call_skip.has(n)) {
-			continue;
+			if (batch_end - i > 1) {
+				if (process_work_pool.get_thread_count() == 0) {
+					process_work_pool.init();
+				}
+				process_thread_notification = p_notification;
+				process_work_pool.do_work(batch_end - i, this, &SceneTree::_process_node_threaded, pl.nodes.ptr() + i);
+				i = batch_end - 1;
+				continue;
+			}
 		}
+#endif
 
 		if (!n->can_process()) {
 			continue;
 		}
-		if (!n->can_process_notification(p_notification)) {
-			continue;
-		}
 
 		n->notification(p_notification);
-		//ERR_FAIL_COND(node_count != g.nodes.size());
 	}
 
-	call_lock--;
-	if (call_lock == 0) {
-		call_skip.clear();
-	}
+	pl.lock--;
 }
 
 /*
@@ -826,36 +920,27 @@ void SceneMainLoop::_update_listener_2d() {
 */
 
 void SceneTree::_call_input_pause(const StringName &p_group, const StringName &p_method, const Ref<InputEvent> &p_input, Viewport *p_viewport) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
+	Group *g = group_map.getptr(p_group);
+	if (!g) {
 		return;
 	}
-	Group &g = E->get();
-	if (g.nodes.is_empty()) {
-		return;
-	}
-
-	_update_group_order(g);
 
-	//copy, so copy on write happens in case something is removed from process while being called
-	//performance is not lost because only if something is added/removed the vector is copied.
-	Vector<Node *> nodes_copy = g.nodes;
+	_update_group_order(p_group, *g);
 
-	int node_count = nodes_copy.size();
-	Node **nodes = nodes_copy.ptrw();
+	int node_count = g->nodes.size();
 
 	Variant arg = p_input;
 	const Variant *v[1] = { &arg };
 
-	call_lock++;
+	g->lock++;
 
 	for (int i = node_count - 1; i >= 0; i--) {
 		if (p_viewport->is_input_handled()) {
 			break;
 		}
 
-		Node *n = nodes[i];
-		if (call_lock && call_skip.has(n)) {
+		Node *n = g->nodes[i];
+		if (!n) {
 			continue;
 		}
 
@@ -874,10 +959,7 @@ void SceneTree::_call_input_pause(const StringName &p_group, const StringName &p
 		}
 	}
 
-	call_lock--;
-	if (call_lock == 0) {
-		call_skip.clear();
-	}
+	_unlock_group(p_group, *g);
 }
 
 Variant SceneTree::_call_group_flags(const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
@@ -891,14 +973,8 @@ Variant SceneTree::_call_group_flags(const Variant **p_args, int p_argcount, Cal
 	int flags = *p_args[0];
 	StringName group = *p_args[1];
 	StringName method = *p_args[2];
-	Variant v[VARIANT_ARG_MAX];
-
-	for (int i = 0; i < MIN(p_argcount - 3, 5); i++) {
-		v[i] = *p_args[i + 3];
-	}
 
-	static_assert(VARIANT_ARG_MAX == 5, "This code needs to be updated if VARIANT_ARG_MAX != 5");
-	call_group_flags(flags, group, method, v[0], v[1], v[2], v[3], v[4]);
+	call_group_flags(flags, group, method, p_args + 3, p_argcount - 3);
 	return Variant();
 }
 
@@ -911,14 +987,8 @@ Variant SceneTree::_call_group(const Variant **p_args, int p_argcount, Callable:
 
 	StringName group = *p_args[0];
 	StringName method = *p_args[1];
-	Variant v[VARIANT_ARG_MAX];
 
-	for (int i = 0; i < MIN(p_argcount - 2, 5); i++) {
-		v[i] = *p_args[i + 2];
-	}
-
-	static_assert(VARIANT_ARG_MAX == 5, "This code needs to be updated if VARIANT_ARG_MAX != 5");
-	call_group_flags(0, group, method, v[0], v[1], v[2], v[3], v[4]);
+	call_group_flags(0, group, method, p_args + 2, p_argcount - 2);
 	return Variant();
 }
 
@@ -928,61 +998,54 @@ int64_t SceneTree::get_frame() const {
 
 Array SceneTree::_get_nodes_in_group(const StringName &p_group) {
 	Array ret;
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
-		return ret;
-	}
-
-	_update_group_order(E->get()); //update order just in case
-	int nc = E->get().nodes.size();
-	if (nc == 0) {
+	Group *g = group_map.getptr(p_group);
+	if (!g) {
 		return ret;
 	}
 
-	ret.resize(nc);
+	_update_group_order(p_group, *g); //update order just in case
+	ret.resize(g->nodes.size() - g->erased);
 
-	Node **ptr = E->get().nodes.ptrw();
-	for (int i = 0; i < nc; i++) {
-		ret[i] = ptr[i];
-	}
+	int idx = 0;
+	for_each_node_in_group(p_group, [&](Node *p_node) {
+		ret[idx++] = p_node;
+	});
 
 	return ret;
 }
 
 bool SceneTree::has_group(const StringName &p_identifier) const {
-	return group_map.has(p_identifier);
+	const Group *g = group_map.getptr(p_identifier);
+	return g && g->nodes.size() > g->erased;
 }
 
 Node *SceneTree::get_first_node_in_group(const StringName &p_group) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
+	Group *g = group_map.getptr(p_group);
+	if (!g) {
 		return nullptr; //no group
 	}
 
-	_update_group_order(E->get()); //update order just in case
+	_update_group_order(p_group, *g); //update order just in case
 
-	if (E->get().nodes.size() == 0) {
-		return nullptr;
+	for (uint32_t i = 0; i < g->nodes.size(); i++) {
+		if (g->nodes[i]) {
+			return g->nodes[i];
+		}
 	}
 
-	return E->get().nodes[0];
+	return nullptr;
 }
 
 void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_list) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
+	Group *g = group_map.getptr(p_group);
+	if (!g) {
 		return;
 	}
 
-	_update_group_order(E->get()); //update order just in case
-	int nc = E->get().nodes.size();
-	if (nc == 0) {
-		return;
-	}
-	Node **ptr = E->get().nodes.ptrw();
-	for (int i = 0; i < nc; i++) {
-		p_list->push_back(ptr[i]);
-	}
+	_update_group_order(p_group, *g); //update order just in case
+	for_each_node_in_group(p_group, [p_list](Node *p_node) {
+		p_list->push_back(p_node);
+	});
 }
 
 void SceneTree::_flush_delete_queue() {
@@ -1052,6 +1115,7 @@ void SceneTree::_change_scene(Node *p_to) {
 }
 
 Error SceneTree::change_scene(const String &p_path) {
+	ERR_PROCESS_THREAD_GUARD_V(ERR_UNAVAILABLE);
 	Ref<PackedScene> new_scene = ResourceLoader::load(p_path);
 	if (new_scene.is_null()) {
 		return ERR_CANT_OPEN;
@@ -1061,6 +1125,7 @@ Error SceneTree::change_scene(const String &p_path) {
 }
 
 Error SceneTree::change_scene_to(const Ref<PackedScene> &p_scene) {
+	ERR_PROCESS_THREAD_GUARD_V(ERR_UNAVAILABLE);
 	Node *new_scene = nullptr;
 	if (p_scene.is_valid()) {
 		new_scene = p_scene->instance();
@@ -1083,6 +1148,7 @@ void SceneTree::add_current_scene(Node *p_current) {
 }
 
 Ref<SceneTreeTimer> SceneTree::create_timer(float p_delay_sec, bool p_process_always) {
+	ERR_PROCESS_THREAD_GUARD_V(Ref<SceneTreeTimer>());
 	Ref<SceneTreeTimer> stt;
 	stt.instance();
 	stt->set_process_always(p_process_always);
@@ -34,7 +34,10 @@
 #include "core/io/multiplayer_api.h"
 #include "core/os/main_loop.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/self_list.h"
+#include "core/templates/thread_work_pool.h"
 #include "scene/resources/mesh.h"
 #include "scene/resources/world_2d.h"
 #include "scene/resources/world_3d.h"
@@ -77,12 +80,27 @@ class SceneTree : public MainLoop {
 public:
 	typedef void (*IdleCallback)();
 
+	enum ProcessListType {
+		PROCESS_LIST_PROCESS,
+		PROCESS_LIST_PHYSICS_PROCESS,
+		PROCESS_LIST_PROCESS_INTERNAL,
+		PROCESS_LIST_PHYSICS_PROCESS_INTERNAL,
+		PROCESS_LIST_MAX
+	};
+
 private:
+	// Groups and processing lists are flat arrays which are walked in place.
+	// Removed nodes leave a null slot (each node knows its index) and the
+	// arrays are only compacted and sorted when not being walked.
 	struct Group {
-		Vector<Node *> nodes;
+		LocalVector<Node *> nodes;
+		uint32_t erased = 0;
 		bool changed = false;
+		int lock = 0;
 	};
 
+	Group process_lists[PROCESS_LIST_MAX];
+
 	Window *root = nullptr;
 
 	uint64_t tree_version = 1;
@@ -98,7 +116,7 @@ private:
 	bool paused = false;
 	int root_lock = 0;
 
-	Map<StringName, Group> group_map;
+	HashMap<StringName, Group> group_map;
 	bool _quit = false;
 	bool initialized = false;
 
@@ -120,9 +138,11 @@ private:
 		bool operator<(const UGCall &p_with) const { return group == p_with.group ? call < p_with.call : group < p_with.group; }
 	};
 
-	// Safety for when a node is deleted while a group is being called.
-	int call_lock = 0;
-	Set<Node *> call_skip; // Skip erased nodes.
+	// Nodes with process_threaded are processed in batches on these threads.
+	ThreadWorkPool process_work_pool;
+	int process_thread_notification = 0;
+	static thread_local bool in_process_thread;
+	void _process_node_threaded(uint32_t p_index, Node **p_nodes);
 
 	List<ObjectID> delete_queue;
 
@@ -130,7 +150,10 @@ private:
 	bool ugc_locked = false;
 	void _flush_ugc();
 
-	_FORCE_INLINE_ void _update_group_order(Group &g, bool p_use_priority = false);
+	void _update_group_order(const StringName &p_name, Group &g);
+	void _compact_group(Group &g);
+	void _unlock_group(const StringName &p_name, Group &g);
+	void _update_process_list(ProcessListType p_list);
 	void _update_listener();
 
 	Array _get_nodes_in_group(const StringName &p_group);
@@ -176,7 +199,11 @@ private:
 	void remove_from_group(const StringName &p_group, Node *p_node);
 	void make_group_changed(const StringName &p_group);
 
-	void _notify_group_pause(const StringName &p_group, int p_notification);
+	void add_to_process_list(ProcessListType p_list, Node *p_node);
+	void remove_from_process_list(ProcessListType p_list, Node *p_node);
+	void make_process_list_changed(ProcessListType p_list);
+
+	void _notify_process_list(ProcessListType p_list, int p_notification);
 	Variant _call_group_flags(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	Variant _call_group(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
@@ -225,14 +252,28 @@ public:
 
 	_FORCE_INLINE_ Window *get_root() const { return root; }
 
-	void call_group_flags(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, VARIANT_ARG_LIST);
+	void call_group_flags(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount);
+	void call_group_flags(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, VARIANT_ARG_DECLARE);
 	void notify_group_flags(uint32_t p_call_flags, const StringName &p_group, int p_notification);
 	void set_group_flags(uint32_t p_call_flags, const StringName &p_group, const String &p_name, const Variant &p_value);
 
-	void call_group(const StringName &p_group, const StringName &p_function, VARIANT_ARG_LIST);
+	void call_group(const StringName &p_group, const StringName &p_function, VARIANT_ARG_DECLARE);
 	void notify_group(const StringName &p_group, int p_notification);
 	void set_group(const StringName &p_group, const String &p_name, const Variant &p_value);
 
+	// Variadic versions, these pass exactly the given arguments.
+	template <class... VarArgs, VARIANT_CALL_ARGS_ENABLE(VarArgs)>
+	void call_group_flags(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const VarArgs &...p_args) {
+		VariantCallArgs<sizeof...(p_args)> args(p_args...);
+		call_group_flags(p_call_flags, p_group, p_function, args.get(), sizeof...(p_args));
+	}
+
+	template <class... VarArgs, VARIANT_CALL_ARGS_ENABLE(VarArgs)>
+	void call_group(const StringName &p_group, const StringName &p_function, const VarArgs &...p_args) {
+		VariantCallArgs<sizeof...(p_args)> args(p_args...);
+		call_group_flags(0, p_group, p_function, args.get(), sizeof...(p_args));
+	}
+
 	void flush_transform_notifications();
 
 	virtual void initialize() override;
@@ -250,6 +291,9 @@ public:
 	_FORCE_INLINE_ float get_physics_process_time() const { return physics_process_time; }
 	_FORCE_INLINE_ float get_process_time() const { return process_time; }
 
+	// True on worker threads while they run _process()/_physics_process() of threaded nodes.
+	_FORCE_INLINE_ static bool is_in_process_thread() { return in_process_thread; }
+
 #ifdef TOOLS_ENABLED
 	bool is_node_being_edited(const Node *p_node) const;
 #else
@@ -303,6 +347,25 @@ public:
 
 	void get_nodes_in_group(const StringName &p_group, List<Node *> *p_list);
 	Node *get_first_node_in_group(const StringName &p_group);
+
+	// Calls p_callback for each node in the group without copying it. Nodes
+	// added by the callback are not visited, removed ones are skipped.
+	template <class C>
+	void for_each_node_in_group(const StringName &p_group, C p_callback) {
+		Group *g = group_map.getptr(p_group);
+		if (!g) {
+			return;
+		}
+
+		uint32_t node_count = g->nodes.size();
+		g->lock++;
+		for (uint32_t i = 0; i < node_count; i++) {
+			if (g->nodes[i]) {
+				p_callback(g->nodes[i]);
+			}
+		}
+		_unlock_group(p_group, *g);
+	}
 	bool has_group(const StringName &p_identifier) const;
 
 	//void change_scene(const String& p_path);
@@ -353,4 +416,16 @@ public:
 
 VARIANT_ENUM_CAST(SceneTree::GroupCallFlags);
 
+#ifdef DEBUG_ENABLED
+// Nodes processed in threads may only change their own state, anything touching
+// the tree or other nodes must go through call_deferred().
+#define ERR_PROCESS_THREAD_GUARD \
+	ERR_FAIL_COND_MSG(SceneTree::is_in_process_thread(), "This function can't be called from a node processed in a thread. Use call_deferred() instead.");
+#define ERR_PROCESS_THREAD_GUARD_V(m_ret) \
+	ERR_FAIL_COND_V_MSG(SceneTree::is_in_process_thread(), m_ret, "This function can't be called from a node processed in a thread. Use call_deferred() instead.");
+#else
+#define ERR_PROCESS_THREAD_GUARD
+#define ERR_PROCESS_THREAD_GUARD_V(m_ret)
+#endif
+
 #endif // SCENE_TREE_H
@@ -45,6 +45,77 @@ bool SceneState::can_instance() const {
 	return nodes.size() > 0;
 }
 
+void SceneState::_prepare() const {
+	MutexLock lock(prepare_mutex);
+	if (prepared.is_set()) {
+		return;
+	}
+
+	prepared_properties.clear();
+	prepared_property_offsets.resize(nodes.size());
+
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		prepared_property_offsets[i] = prepared_properties.size();
+
+		// Only nodes created here from their class have a known type.
+		bool known_type = n.instance < 0 && n.type != TYPE_INSTANCED && n.type >= 0 && n.type < names.size() && !(i == 0 && base_scene_idx >= 0);
+
+		for (int j = 0; j < n.properties.size(); j++) {
+			PreparedProperty pp;
+			int name = n.properties[j].name;
+			if (known_type && name >= 0 && name < names.size() && names[name] != CoreStringNames::get_singleton()->_script) {
+				const ClassDB::PropertySetGet *psg = ClassDB::get_property_setget(names[n.type], names[name]);
+				if (psg && psg->_setptr) {
+					pp.setter = psg->_setptr;
+					pp.index = psg->index;
+				}
+			}
+			prepared_properties.push_back(pp);
+		}
+	}
+
+	prepared_binds.resize(connections.size());
+	for (int i = 0; i < connections.size(); i++) {
+		const ConnectionData &c = connections[i];
+		Vector<Variant> binds;
+		binds.resize(c.binds.size());
+		for (int j = 0; j < c.binds.size(); j++) {
+			ERR_CONTINUE(c.binds[j] < 0 || c.binds[j] >= variants.size());
+			binds.write[j] = variants[c.binds[j]];
+		}
+		prepared_binds[i] = binds;
+	}
+
+	prepared.set();
+}
+
+void SceneState::_clear_prepared() {
+	MutexLock lock(prepare_mutex);
+	prepared.clear();
+	prepared_properties.clear();
+	prepared_property_offsets.clear();
+	prepared_binds.clear();
+}
+
+void SceneState::_set_node_property(Node *p_node, const PreparedProperty &p_prepared, const StringName &p_name, const Variant &p_value) const {
+	// Same as ClassDB::set_property(), unless a script may handle the property first.
+	if (!p_prepared.setter || p_node->get_script_instance()) {
+		p_node->set(p_name, p_value);
+		return;
+	}
+
+	Callable::CallError ce;
+	if (p_prepared.index >= 0) {
+		Variant index = p_prepared.index;
+		const Variant *arg[2] = { &index, &p_value };
+		p_prepared.setter->call(p_node, arg, 2, ce);
+	} else {
+		const Variant *arg[1] = { &p_value };
+		p_prepared.setter->call(p_node, arg, 1, ce);
+	}
+}
+
 Node *SceneState::instance(GenEditState p_edit_state) const {
 	// nodes where instancing failed (because something is missing)
 	List<Node *> stray_instances;
@@ -62,6 +133,12 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 	int nc = nodes.size();
 	ERR_FAIL_COND_V(nc == 0, nullptr);
 
+	if (!prepared.is_set()) {
+		_prepare();
+	}
+	// The editor relies on the regular set() path (e.g. to track edits).
+	bool use_prepared = p_edit_state == GEN_EDIT_STATE_DISABLED;
+
 	const StringName *snames = nullptr;
 	int sname_count = names.size();
 	if (sname_count) {
@@ -104,6 +181,7 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 		}
 
 		Node *node = nullptr;
+		bool created_from_type = false;
 
 		if (i == 0 && base_scene_idx >= 0) {
 			//scene inheritance on root node
@@ -177,6 +255,8 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 			}
 
 			node = Object::cast_to<Node>(obj);
+			// A compatibility class or placeholder may have been created instead.
+			created_from_type = use_prepared && node && node->get_class_name() == snames[n.type];
 		}
 
 		if (node) {
@@ -187,6 +267,7 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 			int nprop_count = n.properties.size();
 			if (nprop_count) {
 				const NodeData::Property *nprops = &n.properties[0];
+				const PreparedProperty *pprops = &prepared_properties[prepared_property_offsets[i]];
 
 				for (int j = 0; j < nprop_count; j++) {
 					bool valid;
@@ -244,7 +325,11 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 						} else if (p_edit_state == GEN_EDIT_STATE_INSTANCE) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor
 						}
-						node->set(snames[nprops[j].name], value, &valid);
+						if (created_from_type) {
+							_set_node_property(node, pprops[j], snames[nprops[j].name], value);
+						} else {
+							node->set(snames[nprops[j].name], value, &valid);
+						}
 					}
 				}
 			}
@@ -317,15 +402,7 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 			continue;
 		}
 
-		Vector<Variant> binds;
-		if (c.binds.size()) {
-			binds.resize(c.binds.size());
-			for (int j = 0; j < c.binds.size(); j++) {
-				binds.write[j] = props[c.binds[j]];
-			}
-		}
-
-		cfrom->connect(snames[c.signal], Callable(cto, snames[c.method]), binds, CONNECT_PERSIST | c.flags);
+		cfrom->connect(snames[c.signal], Callable(cto, snames[c.method]), prepared_binds[i], CONNECT_PERSIST | c.flags);
 	}
 
 	//Node *s = ret_nodes[0];
@@ -346,6 +423,137 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 	return ret_nodes[0];
 }
 
+bool SceneState::reset_instance(Node *p_root) const {
+	ERR_FAIL_NULL_V(p_root, false);
+	int nc = nodes.size();
+	ERR_FAIL_COND_V(nc == 0, false);
+
+	if (!prepared.is_set()) {
+		_prepare();
+	}
+
+	// Resolve every node first, so nothing is touched if the instance no longer
+	// matches the packed hierarchy. Inherited and nested scenes are not supported.
+	if (base_scene_idx >= 0) {
+		return false;
+	}
+
+	Node **ret_nodes = (Node **)alloca(sizeof(Node *) * nc);
+	int *child_counts = (int *)alloca(sizeof(int) * nc);
+
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+		child_counts[i] = 0;
+
+		if (n.instance >= 0 || n.type == TYPE_INSTANCED) {
+			return false;
+		}
+
+		Node *node = p_root;
+		if (i > 0) {
+			if (n.parent < 0 || n.parent >= i) {
+				return false;
+			}
+			node = ret_nodes[n.parent]->_get_child_by_name(names[n.name]);
+			child_counts[n.parent]++;
+		}
+
+		if (!node || node->get_class_name() != names[n.type]) {
+			return false;
+		}
+		ret_nodes[i] = node;
+	}
+
+	for (int i = 0; i < nc; i++) {
+		Node *node = ret_nodes[i];
+		if (node->get_child_count() != child_counts[i]) {
+			return false;
+		}
+
+		// Groups and connections added at runtime can't be told apart from the
+		// ones the instance needs, so nodes that have them are not reused.
+		List<Node::GroupInfo> node_groups;
+		node->get_groups(&node_groups);
+		if (node_groups.size() != nodes[i].groups.size()) {
+			return false;
+		}
+		for (List<Node::GroupInfo>::Element *E = node_groups.front(); E; E = E->next()) {
+			if (!E->get().persistent) {
+				return false;
+			}
+		}
+
+		List<Connection> node_connections;
+		node->get_all_signal_connections(&node_connections);
+		for (List<Connection>::Element *E = node_connections.front(); E; E = E->next()) {
+			if (!(E->get().flags & CONNECT_PERSIST)) {
+				return false;
+			}
+		}
+	}
+
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+		Node *node = ret_nodes[i];
+
+		// Give the node a new script instance, so script members start over too.
+		Variant script;
+		Set<StringName> stored;
+		for (int j = 0; j < n.properties.size(); j++) {
+			const StringName &name = names[n.properties[j].name];
+			if (name == CoreStringNames::get_singleton()->_script) {
+				script = variants[n.properties[j].value];
+			}
+			stored.insert(name);
+		}
+
+		if (node->get_script_instance() || !node->get_script().is_null()) {
+			node->set_script(Variant());
+		}
+		if (!script.is_null()) {
+			node->set_script(script);
+			node->request_ready();
+		}
+
+		// Properties that were not stored had their default value when packed.
+		List<PropertyInfo> plist;
+		ClassDB::get_property_list(node->get_class_name(), &plist);
+		for (List<PropertyInfo>::Element *E = plist.front(); E; E = E->next()) {
+			const PropertyInfo &pi = E->get();
+			if (!(pi.usage & PROPERTY_USAGE_STORAGE) || pi.name == "script" || stored.has(pi.name)) {
+				continue;
+			}
+
+			bool valid = false;
+			Variant default_value = ClassDB::class_get_default_property_value(node->get_class_name(), pi.name, &valid);
+			if (valid) {
+				node->set(pi.name, default_value);
+			}
+		}
+
+		for (int j = 0; j < n.properties.size(); j++) {
+			const StringName &name = names[n.properties[j].name];
+			const Variant &value = variants[n.properties[j].value];
+
+			if (name == CoreStringNames::get_singleton()->_script) {
+				continue;
+			}
+
+			if (value.get_type() == Variant::OBJECT) {
+				// The instance owns a copy of resources local to scene, keep it.
+				Ref<Resource> res = value;
+				if (res.is_valid() && res->is_local_to_scene()) {
+					continue;
+				}
+			}
+
+			_set_node_property(node, prepared_properties[prepared_property_offsets[i] + j], name, value);
+		}
+	}
+
+	return true;
+}
+
 static int _nm_get_string(const String &p_string, Map<StringName, int> &name_map) {
 	if (name_map.has(p_string)) {
 		return name_map[p_string];
@@ -905,6 +1113,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_prepared();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1061,6 +1270,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	ERR_FAIL_COND(!p_dictionary.has("conns"));
 	//ERR_FAIL_COND( !p_dictionary.has("path"));
 
+	_clear_prepared();
+
 	int version = 1;
 	if (p_dictionary.has("version")) {
 		version = p_dictionary["version"];
@@ -1505,6 +1716,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.instance = p_instance;
 	nd.index = p_index;
 
+	_clear_prepared();
 	nodes.push_back(nd);
 
 	return nodes.size() - 1;
@@ -1515,6 +1727,8 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value) {
 	ERR_FAIL_INDEX(p_name, names.size());
 	ERR_FAIL_INDEX(p_value, variants.size());
 
+	_clear_prepared();
+
 	NodeData::Property prop;
 	prop.name = p_name;
 	prop.value = p_value;
@@ -1529,6 +1743,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
+	_clear_prepared();
 	base_scene_idx = p_idx;
 }
 
@@ -1539,6 +1754,8 @@ void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method
 	for (int i = 0; i < p_binds.size(); i++) {
 		ERR_FAIL_INDEX(p_binds[i], variants.size());
 	}
+	_clear_prepared();
+
 	ConnectionData c;
 	c.from = p_from;
 	c.to = p_to;
@@ -1599,6 +1816,7 @@ SceneState::SceneState() {
 ////////////////
 
 void PackedScene::_set_bundled_scene(const Dictionary &p_scene) {
+	_clear_pool();
 	state->set_bundled_scene(p_scene);
 }
 
@@ -1607,10 +1825,12 @@ Dictionary PackedScene::_get_bundled_scene() const {
 }
 
 Error PackedScene::pack(Node *p_scene) {
+	_clear_pool();
 	return state->pack(p_scene);
 }
 
 void PackedScene::clear() {
+	_clear_pool();
 	state->clear();
 }
 
@@ -1641,7 +1861,87 @@ Node *PackedScene::instance(GenEditState p_edit_state) const {
 	return s;
 }
 
+TypedArray<Node> PackedScene::instance_multiple(int p_count, GenEditState p_edit_state) const {
+	ERR_FAIL_COND_V(p_count < 0, TypedArray<Node>());
+
+	TypedArray<Node> ret;
+	ret.resize(p_count);
+	for (int i = 0; i < p_count; i++) {
+		Node *s = instance(p_edit_state);
+		if (!s) {
+			ret.resize(i);
+			break;
+		}
+		ret[i] = s;
+	}
+
+	return ret;
+}
+
+void PackedScene::set_pool_size(int p_size) {
+	ERR_FAIL_COND(p_size < 0);
+
+	MutexLock lock(pool_mutex);
+	pool_size = p_size;
+	while ((int)pool.size() > pool_size) {
+		memdelete(pool[pool.size() - 1]);
+		pool.resize(pool.size() - 1);
+	}
+}
+
+int PackedScene::get_pool_size() const {
+	return pool_size;
+}
+
+Node *PackedScene::instance_pooled() {
+	{
+		MutexLock lock(pool_mutex);
+		if (pool.size()) {
+			Node *s = pool[pool.size() - 1];
+			pool.resize(pool.size() - 1);
+			return s;
+		}
+	}
+
+	return instance();
+}
+
+bool PackedScene::recycle(Node *p_node) {
+	ERR_FAIL_NULL_V(p_node, false);
+	ERR_FAIL_COND_V_MSG(get_path() != "" && get_path().find("::") == -1 && p_node->get_filename() != get_path(), false, "Node was not instanced from this scene.");
+
+	if (p_node->get_parent()) {
+		p_node->get_parent()->remove_child(p_node);
+	}
+
+	{
+		MutexLock lock(pool_mutex);
+		if ((int)pool.size() < pool_size && state->reset_instance(p_node)) {
+			pool.push_back(p_node);
+			return true;
+		}
+	}
+
+	// This may be called from the node's own script or from one of its signals,
+	// so it can't be freed right away.
+	if (SceneTree::get_singleton()) {
+		p_node->queue_delete();
+	} else {
+		memdelete(p_node);
+	}
+	return false;
+}
+
+void PackedScene::_clear_pool() {
+	MutexLock lock(pool_mutex);
+	for (uint32_t i = 0; i < pool.size(); i++) {
+		memdelete(pool[i]);
+	}
+	pool.clear();
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
+	_clear_pool();
 	state = p_by;
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -1650,6 +1950,7 @@ void PackedScene::replace_state(Ref<SceneState> p_by) {
 }
 
 void PackedScene::recreate_state() {
+	_clear_pool();
 	state = Ref<SceneState>(memnew(SceneState));
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -1672,7 +1973,12 @@ void PackedScene::reset_state() {
 void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instance", "edit_state"), &PackedScene::instance, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instance_multiple", "count", "edit_state"), &PackedScene::instance_multiple, DEFVAL(GEN_EDIT_STATE_DISABLED));
 	ClassDB::bind_method(D_METHOD("can_instance"), &PackedScene::can_instance);
+	ClassDB::bind_method(D_METHOD("set_pool_size", "size"), &PackedScene::set_pool_size);
+	ClassDB::bind_method(D_METHOD("get_pool_size"), &PackedScene::get_pool_size);
+	ClassDB::bind_method(D_METHOD("instance_pooled"), &PackedScene::instance_pooled);
+	ClassDB::bind_method(D_METHOD("recycle", "node"), &PackedScene::recycle);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
 	ClassDB::bind_method(D_METHOD("get_state"), &PackedScene::get_state);
@@ -1687,3 +1993,7 @@ void PackedScene::_bind_methods() {
 PackedScene::PackedScene() {
 	state = Ref<SceneState>(memnew(SceneState));
 }
+
+PackedScene::~PackedScene() {
+	_clear_pool();
+}
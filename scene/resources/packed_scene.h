@@ -32,6 +32,7 @@
 #define PACKED_SCENE_H
 
 #include "core/io/resource.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/node.h"
 
 class SceneState : public Reference {
@@ -87,6 +88,23 @@ class SceneState : public Reference {
 
 	Vector<ConnectionData> connections;
 
+	// Resolved once and reused by every instance. Properties of nodes created
+	// from their class are set through their bound setter directly.
+	struct PreparedProperty {
+		MethodBind *setter = nullptr; // Null if it must be set by name.
+		int index = -1;
+	};
+
+	mutable LocalVector<PreparedProperty> prepared_properties; // Flattened, in node order.
+	mutable LocalVector<uint32_t> prepared_property_offsets; // First property of each node.
+	mutable LocalVector<Vector<Variant>> prepared_binds; // Binds of each connection.
+	mutable SafeFlag prepared;
+	mutable Mutex prepare_mutex;
+
+	void _prepare() const;
+	void _clear_prepared();
+	_FORCE_INLINE_ void _set_node_property(Node *p_node, const PreparedProperty &p_prepared, const StringName &p_name, const Variant &p_value) const;
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, Map<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, Map<Node *, int> &node_map, Map<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, Map<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, Map<Node *, int> &node_map, Map<Node *, int> &nodepath_map);
 
@@ -138,6 +156,7 @@ public:
 
 	bool can_instance() const;
 	Node *instance(GenEditState p_edit_state) const;
+	bool reset_instance(Node *p_root) const;
 
 	//unbuild API
 
@@ -194,6 +213,13 @@ class PackedScene : public Resource {
 
 	Ref<SceneState> state;
 
+	// Recycled instances, already reset to the packed state.
+	LocalVector<Node *> pool;
+	int pool_size = 0;
+	Mutex pool_mutex;
+
+	void _clear_pool();
+
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
@@ -215,6 +241,12 @@ public:
 
 	bool can_instance() const;
 	Node *instance(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+	TypedArray<Node> instance_multiple(int p_count, GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+
+	void set_pool_size(int p_size);
+	int get_pool_size() const;
+	Node *instance_pooled();
+	bool recycle(Node *p_node);
 
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
@@ -227,6 +259,7 @@ public:
 	Ref<SceneState> get_state();
 
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
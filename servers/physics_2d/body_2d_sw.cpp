@@ -247,11 +247,13 @@ void Body2DSW::set_state(PhysicsServer2D::BodyState p_state, const Variant &p_va
 				if (first_time_kinematic) {
 					_set_transform(p_variant);
 					_set_inv_transform(get_transform().affine_inverse());
+					previous_transform = get_transform();
 					first_time_kinematic = false;
 				}
 			} else if (mode == PhysicsServer2D::BODY_MODE_STATIC) {
 				_set_transform(p_variant);
 				_set_inv_transform(get_transform().affine_inverse());
+				previous_transform = get_transform();
 				wakeup_neighbours();
 			} else {
 				Transform2D t = p_variant;
@@ -262,6 +264,7 @@ void Body2DSW::set_state(PhysicsServer2D::BodyState p_state, const Variant &p_va
 				}
 				_set_transform(t);
 				_set_inv_transform(get_transform().inverse());
+				previous_transform = get_transform(); // Teleported, nothing to interpolate from.
 			}
 			wakeup();
 
@@ -439,6 +442,7 @@ void Body2DSW::integrate_forces(real_t p_step) {
 	*/
 
 	Vector2 motion;
+	real_t rotation = 0;
 	bool do_motion = false;
 
 	if (mode == PhysicsServer2D::BODY_MODE_KINEMATIC) {
@@ -489,6 +493,9 @@ void Body2DSW::integrate_forces(real_t p_step) {
 			motion = linear_velocity * p_step;
 			do_motion = true;
 		}
+		if (continuous_cd_mode == PhysicsServer2D::CCD_MODE_CAST_SHAPE) {
+			rotation = angular_velocity * p_step; // fast rotations are cast too
+		}
 	}
 
 	//motion=linear_velocity*p_step;
@@ -498,7 +505,8 @@ void Body2DSW::integrate_forces(real_t p_step) {
 	biased_linear_velocity = Vector2();
 
 	if (do_motion) { //shapes temporarily extend for raycast
-		_update_shapes_with_motion(motion);
+		_update_shape_aabbs_with_motion(motion, rotation);
+		broadphase_update_pending = true;
 	}
 
 	// damp_area=nullptr; // clear the area, so it is set in the next frame
@@ -512,14 +520,16 @@ void Body2DSW::integrate_velocities(real_t p_step) {
 	}
 
 	if (fi_callback) {
-		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+		state_query_pending = true;
 	}
 
+	previous_transform = get_transform();
+
 	if (mode == PhysicsServer2D::BODY_MODE_KINEMATIC) {
 		_set_transform(new_transform, false);
 		_set_inv_transform(new_transform.affine_inverse());
 		if (contacts.size() == 0 && linear_velocity == Vector2() && angular_velocity == 0) {
-			set_active(false); //stopped moving, deactivate
+			deactivation_pending = true; //stopped moving, deactivate
 		}
 		return;
 	}
@@ -530,16 +540,67 @@ void Body2DSW::integrate_velocities(real_t p_step) {
 	real_t angle = get_transform().get_rotation() + total_angular_velocity * p_step;
 	Vector2 pos = get_transform().get_origin() + total_linear_velocity * p_step;
 
-	_set_transform(Transform2D(angle, pos), continuous_cd_mode == PhysicsServer2D::CCD_MODE_DISABLED);
+	_set_transform(Transform2D(angle, pos), false);
 	_set_inv_transform(get_transform().inverse());
 
-	if (continuous_cd_mode != PhysicsServer2D::CCD_MODE_DISABLED) {
+	if (continuous_cd_mode == PhysicsServer2D::CCD_MODE_DISABLED) {
+		_update_shape_aabbs();
+		broadphase_update_pending = true;
+	} else {
 		new_transform = get_transform();
 	}
 
 	//_update_inertia_tensor();
 }
 
+void Body2DSW::apply_integration() {
+	if (broadphase_update_pending) {
+		_update_broadphase();
+		broadphase_update_pending = false;
+	}
+
+	if (state_query_pending) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+		state_query_pending = false;
+	}
+
+	if (deactivation_pending) {
+		set_active(false);
+		deactivation_pending = false;
+	}
+}
+
+void Body2DSW::save_state(State &r_state) const {
+	r_state.transform = get_transform();
+	r_state.inv_transform = get_inv_transform();
+	r_state.previous_transform = previous_transform;
+	r_state.new_transform = new_transform;
+	r_state.linear_velocity = linear_velocity;
+	r_state.angular_velocity = angular_velocity;
+	r_state.applied_force = applied_force;
+	r_state.applied_torque = applied_torque;
+	r_state.still_time = still_time;
+	r_state.active = active;
+}
+
+void Body2DSW::load_state(const State &p_state) {
+	_set_transform(p_state.transform);
+	_set_inv_transform(p_state.inv_transform);
+	previous_transform = p_state.previous_transform;
+	new_transform = p_state.new_transform;
+	linear_velocity = p_state.linear_velocity;
+	angular_velocity = p_state.angular_velocity;
+	applied_force = p_state.applied_force;
+	applied_torque = p_state.applied_torque;
+	still_time = p_state.still_time;
+	set_active(p_state.active);
+
+	// Moved outside of a step, the node must still receive the restored state.
+	if (fi_callback && !direct_state_query_list.in_list()) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+}
+
 void Body2DSW::wakeup_neighbours() {
 	for (List<Pair<Constraint2DSW *, int>>::Element *E = constraint_list.front(); E; E = E->next()) {
 		const Constraint2DSW *c = E->get().first;
@@ -637,6 +698,7 @@ Body2DSW::Body2DSW() :
 	omit_force_integration = false;
 	applied_torque = 0;
 	island_step = 0;
+	solver_color_mask = 0;
 	_set_static(false);
 	first_time_kinematic = false;
 	linear_damp = -1;
@@ -646,6 +708,9 @@ Body2DSW::Body2DSW() :
 	contact_count = 0;
 	gravity_scale = 1.0;
 	first_integration = false;
+	broadphase_update_pending = false;
+	state_query_pending = false;
+	deactivation_pending = false;
 
 	still_time = 0;
 	continuous_cd_mode = PhysicsServer2D::CCD_MODE_DISABLED;
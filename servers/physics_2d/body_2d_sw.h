@@ -81,9 +81,15 @@ class Body2DSW : public CollisionObject2DSW {
 	bool can_sleep;
 	bool first_time_kinematic;
 	bool first_integration;
+
+	// Work left by the integration steps, which can run on worker threads.
+	bool broadphase_update_pending;
+	bool state_query_pending;
+	bool deactivation_pending;
 	void _update_inertia();
 	virtual void _shapes_changed();
 	Transform2D new_transform;
+	Transform2D previous_transform;
 
 	List<Pair<Constraint2DSW *, int>> constraint_list;
 
@@ -124,6 +130,7 @@ class Body2DSW : public CollisionObject2DSW {
 	ForceIntegrationCallback *fi_callback;
 
 	uint64_t island_step;
+	uint32_t solver_color_mask;
 
 	_FORCE_INLINE_ void _compute_area_gravity_and_dampenings(const Area2DSW *p_area);
 
@@ -169,9 +176,14 @@ public:
 	_FORCE_INLINE_ bool has_exception(const RID &p_exception) const { return exceptions.has(p_exception); }
 	_FORCE_INLINE_ const VSet<RID> &get_exceptions() const { return exceptions; }
 
+	_FORCE_INLINE_ const Transform2D &get_previous_transform() const { return previous_transform; }
+
 	_FORCE_INLINE_ uint64_t get_island_step() const { return island_step; }
 	_FORCE_INLINE_ void set_island_step(uint64_t p_step) { island_step = p_step; }
 
+	_FORCE_INLINE_ uint32_t get_solver_color_mask() const { return solver_color_mask; }
+	_FORCE_INLINE_ void set_solver_color_mask(uint32_t p_mask) { solver_color_mask = p_mask; }
+
 	_FORCE_INLINE_ void add_constraint(Constraint2DSW *p_constraint, int p_pos) { constraint_list.push_back({ p_constraint, p_pos }); }
 	_FORCE_INLINE_ void remove_constraint(Constraint2DSW *p_constraint, int p_pos) { constraint_list.erase({ p_constraint, p_pos }); }
 	const List<Pair<Constraint2DSW *, int>> &get_constraint_list() const { return constraint_list; }
@@ -263,8 +275,28 @@ public:
 	_FORCE_INLINE_ real_t get_linear_damp() const { return linear_damp; }
 	_FORCE_INLINE_ real_t get_angular_damp() const { return angular_damp; }
 
+	// Safe to call from worker threads for different bodies,
+	// the shared space data is updated afterwards in apply_integration().
 	void integrate_forces(real_t p_step);
 	void integrate_velocities(real_t p_step);
+	void apply_integration();
+
+	// Simulation state, saved in space snapshots.
+	struct State {
+		Transform2D transform;
+		Transform2D inv_transform;
+		Transform2D previous_transform;
+		Transform2D new_transform;
+		Vector2 linear_velocity;
+		real_t angular_velocity;
+		Vector2 applied_force;
+		real_t applied_torque;
+		real_t still_time;
+		bool active;
+	};
+
+	void save_state(State &r_state) const;
+	void load_state(const State &p_state);
 
 	_FORCE_INLINE_ Vector2 get_motion() const {
 		if (mode > PhysicsServer2D::BODY_MODE_KINEMATIC) {
@@ -351,6 +383,7 @@ public:
 
 	virtual void set_transform(const Transform2D &p_transform) override { body->set_state(PhysicsServer2D::BODY_STATE_TRANSFORM, p_transform); }
 	virtual Transform2D get_transform() const override { return body->get_transform(); }
+	virtual Transform2D get_previous_transform() const override { return body->get_previous_transform(); }
 
 	virtual void add_central_force(const Vector2 &p_force) override { body->add_central_force(p_force); }
 	virtual void add_force(const Vector2 &p_force, const Vector2 &p_position = Vector2()) override { body->add_force(p_force, p_position); }
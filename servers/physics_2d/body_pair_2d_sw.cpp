@@ -34,6 +34,7 @@
 
 #define POSITION_CORRECTION
 #define ACCUMULATE_IMPULSES
+#define CCD_MAX_ROTATION_STEPS 16
 
 void BodyPair2DSW::_add_contact(const Vector2 &p_point_A, const Vector2 &p_point_B, void *p_self) {
 	BodyPair2DSW *self = (BodyPair2DSW *)p_self;
@@ -41,6 +42,34 @@ void BodyPair2DSW::_add_contact(const Vector2 &p_point_A, const Vector2 &p_point
 	self->_contact_added_callback(p_point_A, p_point_B);
 }
 
+void BodyPair2DSW::_add_ccd_rotation_contact(const Vector2 &p_point_A, const Vector2 &p_point_B, void *p_userdata) {
+	CCDRotationContacts *ccd = (CCDRotationContacts *)p_userdata;
+
+	// The contact is found with the shape rotated ahead, move its point back onto the shape at its current
+	// transform, so the contact pushes where the shape will hit. The shapes don't overlap yet, so the depth
+	// is kept within the allowed penetration: the contact stops the rotation without pushing the body away.
+	const Vector2 &rotated = ccd->swap ? p_point_B : p_point_A;
+	const Vector2 &other = ccd->swap ? p_point_A : p_point_B;
+
+	Vector2 separation = rotated - other;
+	real_t length = separation.length();
+	if (length < CMP_EPSILON) {
+		return;
+	}
+	Vector2 normal = separation / length;
+	real_t depth = MIN(length, ccd->pair->space->get_contact_max_allowed_penetration());
+
+	Vector2 current = ccd->inv_motion.xform(rotated);
+	Vector2 point = current + normal * normal.dot(rotated - current);
+	Vector2 other_point = point - normal * depth;
+
+	if (ccd->swap) {
+		ccd->pair->_contact_added_callback(other_point, point);
+	} else {
+		ccd->pair->_contact_added_callback(point, other_point);
+	}
+}
+
 void BodyPair2DSW::_contact_added_callback(const Vector2 &p_point_A, const Vector2 &p_point_B) {
 	// check if we already have the contact
 
@@ -217,6 +246,59 @@ bool BodyPair2DSW::_test_ccd(real_t p_step, Body2DSW *p_A, int p_shape_A, const
 	return true;
 }
 
+bool BodyPair2DSW::_test_ccd_rotation(real_t p_step, Body2DSW *p_A, int p_shape_A, const Transform2D &p_xform_A, Body2DSW *p_B, int p_shape_B, const Transform2D &p_xform_B, bool p_swap_result) {
+	// The shape cast only sweeps the linear motion, fast rotating bodies are cast again in rotation steps
+	// short enough for any point of the shape to stay within the contact separation in each of them.
+
+	Shape2DSW *shape_A_ptr = p_A->get_shape(p_shape_A);
+	Shape2DSW *shape_B_ptr = p_B->get_shape(p_shape_B);
+
+	real_t angle = p_A->get_angular_velocity() * p_step;
+
+	// the body rotates around its origin
+	Vector2 body_origin = p_xform_A.get_origin() - p_A->get_transform().basis_xform(p_A->get_shape_transform(p_shape_A).get_origin());
+	Rect2 shape_rect = p_xform_A.xform(shape_A_ptr->get_aabb());
+
+	real_t radius = 0;
+	radius = MAX(radius, shape_rect.position.distance_to(body_origin));
+	radius = MAX(radius, (shape_rect.position + Vector2(shape_rect.size.x, 0)).distance_to(body_origin));
+	radius = MAX(radius, (shape_rect.position + Vector2(0, shape_rect.size.y)).distance_to(body_origin));
+	radius = MAX(radius, (shape_rect.position + shape_rect.size).distance_to(body_origin));
+
+	real_t rotation_sweep = Math::abs(angle) * radius;
+	real_t tolerance = space->get_contact_max_separation();
+
+	if (rotation_sweep <= tolerance) {
+		return false; // the linear cast already covered it
+	}
+
+	int steps = MIN((int)Math::ceil(rotation_sweep / tolerance), CCD_MAX_ROTATION_STEPS);
+	Vector2 step_motion = p_A->get_linear_velocity() * p_step / steps;
+
+	CCDRotationContacts ccd;
+	ccd.pair = this;
+	ccd.swap = p_swap_result;
+
+	for (int i = 1; i < steps; i++) {
+		Transform2D motion = Transform2D(angle * i / steps, body_origin + step_motion * i) * Transform2D(0, -body_origin);
+		Transform2D xform = motion * p_xform_A;
+		ccd.inv_motion = motion.affine_inverse();
+
+		bool hit;
+		if (p_swap_result) {
+			hit = CollisionSolver2DSW::solve(shape_B_ptr, p_xform_B, Vector2(), shape_A_ptr, xform, step_motion, _add_ccd_rotation_contact, &ccd);
+		} else {
+			hit = CollisionSolver2DSW::solve(shape_A_ptr, xform, step_motion, shape_B_ptr, p_xform_B, Vector2(), _add_ccd_rotation_contact, &ccd);
+		}
+
+		if (hit) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 real_t combine_bounce(Body2DSW *A, Body2DSW *B) {
 	return CLAMP(A->get_bounce() + B->get_bounce(), 0, 1);
 }
@@ -292,6 +374,18 @@ bool BodyPair2DSW::setup(real_t p_step) {
 			}
 		}
 
+		if (!collided && A->get_continuous_collision_detection_mode() == PhysicsServer2D::CCD_MODE_CAST_SHAPE && dynamic_A) {
+			if (_test_ccd_rotation(p_step, A, shape_A, xform_A, B, shape_B, xform_B)) {
+				collided = true;
+			}
+		}
+
+		if (!collided && B->get_continuous_collision_detection_mode() == PhysicsServer2D::CCD_MODE_CAST_SHAPE && dynamic_B) {
+			if (_test_ccd_rotation(p_step, B, shape_B, xform_B, A, shape_A, xform_A, true)) {
+				collided = true;
+			}
+		}
+
 		if (!collided) {
 			oneway_disabled = false;
 			return false;
@@ -534,10 +628,47 @@ BodyPair2DSW::BodyPair2DSW(Body2DSW *p_A, int p_shape_A, Body2DSW *p_B, int p_sh
 	shape_A = p_shape_A;
 	shape_B = p_shape_B;
 	space = A->get_space();
+	set_key(A->get_self().get_id(), B->get_self().get_id(), ((uint64_t)(uint32_t)shape_A << 32) | (uint32_t)shape_B);
 	A->add_constraint(this, 0);
 	B->add_constraint(this, 1);
 }
 
+int BodyPair2DSW::get_state_size() const {
+	return sizeof(State) + contact_count * sizeof(Contact);
+}
+
+void BodyPair2DSW::save_state(uint8_t *r_state) const {
+	State state;
+	state.sep_axis = sep_axis;
+	state.contact_count = contact_count;
+	state.collided = collided;
+	state.oneway_disabled = oneway_disabled;
+	memcpy(r_state, &state, sizeof(State));
+	memcpy(r_state + sizeof(State), contacts, contact_count * sizeof(Contact));
+}
+
+void BodyPair2DSW::load_state(const uint8_t *p_state, int p_size) {
+	if (p_size == 0) {
+		sep_axis = Vector2();
+		contact_count = 0;
+		collided = false;
+		oneway_disabled = false;
+		return;
+	}
+
+	ERR_FAIL_COND(p_size < (int)sizeof(State));
+	State state;
+	memcpy(&state, p_state, sizeof(State));
+	ERR_FAIL_COND(state.contact_count < 0 || state.contact_count > MAX_CONTACTS);
+	ERR_FAIL_COND(p_size != (int)(sizeof(State) + state.contact_count * sizeof(Contact)));
+
+	sep_axis = state.sep_axis;
+	contact_count = state.contact_count;
+	collided = state.collided;
+	oneway_disabled = state.oneway_disabled;
+	memcpy(contacts, p_state + sizeof(State), contact_count * sizeof(Contact));
+}
+
 BodyPair2DSW::~BodyPair2DSW() {
 	A->remove_constraint(this, 0);
 	B->remove_constraint(this, 1);
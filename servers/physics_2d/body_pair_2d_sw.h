@@ -81,9 +81,25 @@ class BodyPair2DSW : public Constraint2DSW {
 	bool oneway_disabled = false;
 	bool report_contacts_only = false;
 
+	// Saved in space snapshots, followed by the contacts.
+	struct State {
+		Vector2 sep_axis;
+		int contact_count;
+		bool collided;
+		bool oneway_disabled;
+	};
+
 	bool _test_ccd(real_t p_step, Body2DSW *p_A, int p_shape_A, const Transform2D &p_xform_A, Body2DSW *p_B, int p_shape_B, const Transform2D &p_xform_B, bool p_swap_result = false);
+	bool _test_ccd_rotation(real_t p_step, Body2DSW *p_A, int p_shape_A, const Transform2D &p_xform_A, Body2DSW *p_B, int p_shape_B, const Transform2D &p_xform_B, bool p_swap_result = false);
 	void _validate_contacts();
 	static void _add_contact(const Vector2 &p_point_A, const Vector2 &p_point_B, void *p_self);
+
+	struct CCDRotationContacts {
+		BodyPair2DSW *pair = nullptr;
+		Transform2D inv_motion; // Moves the rotating shape back to its current transform.
+		bool swap = false;
+	};
+	static void _add_ccd_rotation_contact(const Vector2 &p_point_A, const Vector2 &p_point_B, void *p_userdata);
 	_FORCE_INLINE_ void _contact_added_callback(const Vector2 &p_point_A, const Vector2 &p_point_B);
 
 public:
@@ -91,6 +107,10 @@ public:
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual int get_state_size() const override;
+	virtual void save_state(uint8_t *r_state) const override;
+	virtual void load_state(const uint8_t *p_state, int p_size) override;
+
 	BodyPair2DSW(Body2DSW *p_A, int p_shape_A, Body2DSW *p_B, int p_shape_B);
 	~BodyPair2DSW();
 };
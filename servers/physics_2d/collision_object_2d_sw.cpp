@@ -175,6 +175,20 @@ void CollisionObject2DSW::_update_shapes() {
 		return;
 	}
 
+	_update_shape_aabbs();
+	_update_broadphase();
+}
+
+void CollisionObject2DSW::_update_shapes_with_motion(const Vector2 &p_motion) {
+	if (!space) {
+		return;
+	}
+
+	_update_shape_aabbs_with_motion(p_motion);
+	_update_broadphase();
+}
+
+void CollisionObject2DSW::_update_shape_aabbs() {
 	for (int i = 0; i < shapes.size(); i++) {
 		Shape &s = shapes.write[i];
 
@@ -188,17 +202,39 @@ void CollisionObject2DSW::_update_shapes() {
 		shape_aabb = xform.xform(shape_aabb);
 		shape_aabb.grow_by((s.aabb_cache.size.x + s.aabb_cache.size.y) * 0.5 * 0.05);
 		s.aabb_cache = shape_aabb;
+	}
+}
 
-		if (s.bpid == 0) {
-			s.bpid = space->get_broadphase()->create(this, i, shape_aabb, _static);
-			space->get_broadphase()->set_static(s.bpid, _static);
+void CollisionObject2DSW::_update_shape_aabbs_with_motion(const Vector2 &p_motion, real_t p_rotation) {
+	for (int i = 0; i < shapes.size(); i++) {
+		Shape &s = shapes.write[i];
+		if (s.disabled) {
+			continue;
 		}
 
-		space->get_broadphase()->move(s.bpid, shape_aabb);
+		//not quite correct, should compute the next matrix..
+		Rect2 shape_aabb = s.shape->get_aabb();
+		Transform2D xform = transform * s.xform;
+		shape_aabb = xform.xform(shape_aabb);
+
+		real_t rotation_sweep = 0;
+		if (p_rotation != 0) {
+			// no point moves farther than the arc it follows, nor than the diameter of the circle
+			real_t radius = 0;
+			const Vector2 &origin = transform.get_origin();
+			radius = MAX(radius, shape_aabb.position.distance_to(origin));
+			radius = MAX(radius, (shape_aabb.position + Vector2(shape_aabb.size.x, 0)).distance_to(origin));
+			radius = MAX(radius, (shape_aabb.position + Vector2(0, shape_aabb.size.y)).distance_to(origin));
+			radius = MAX(radius, (shape_aabb.position + shape_aabb.size).distance_to(origin));
+			rotation_sweep = MIN(Math::abs(p_rotation), (real_t)2.0) * radius;
+		}
+
+		shape_aabb = shape_aabb.merge(Rect2(shape_aabb.position + p_motion, shape_aabb.size)); //use motion
+		s.aabb_cache = shape_aabb.grow(rotation_sweep);
 	}
 }
 
-void CollisionObject2DSW::_update_shapes_with_motion(const Vector2 &p_motion) {
+void CollisionObject2DSW::_update_broadphase() {
 	if (!space) {
 		return;
 	}
@@ -209,19 +245,12 @@ void CollisionObject2DSW::_update_shapes_with_motion(const Vector2 &p_motion) {
 			continue;
 		}
 
-		//not quite correct, should compute the next matrix..
-		Rect2 shape_aabb = s.shape->get_aabb();
-		Transform2D xform = transform * s.xform;
-		shape_aabb = xform.xform(shape_aabb);
-		shape_aabb = shape_aabb.merge(Rect2(shape_aabb.position + p_motion, shape_aabb.size)); //use motion
-		s.aabb_cache = shape_aabb;
-
 		if (s.bpid == 0) {
-			s.bpid = space->get_broadphase()->create(this, i, shape_aabb, _static);
+			s.bpid = space->get_broadphase()->create(this, i, s.aabb_cache, _static);
 			space->get_broadphase()->set_static(s.bpid, _static);
 		}
 
-		space->get_broadphase()->move(s.bpid, shape_aabb);
+		space->get_broadphase()->move(s.bpid, s.aabb_cache);
 	}
 }
 
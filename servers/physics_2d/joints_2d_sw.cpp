@@ -193,6 +193,20 @@ void PinJoint2DSW::solve(real_t p_step) {
 	P += impulse;
 }
 
+void PinJoint2DSW::save_state(uint8_t *r_state) const {
+	memcpy(r_state, &P, sizeof(Vector2));
+}
+
+void PinJoint2DSW::load_state(const uint8_t *p_state, int p_size) {
+	if (p_size == 0) {
+		P = Vector2();
+		return;
+	}
+
+	ERR_FAIL_COND(p_size != (int)sizeof(Vector2));
+	memcpy(&P, p_state, sizeof(Vector2));
+}
+
 void PinJoint2DSW::set_param(PhysicsServer2D::PinJointParam p_param, real_t p_value) {
 	if (p_param == PhysicsServer2D::PIN_JOINT_SOFTNESS) {
 		softness = p_value;
@@ -360,6 +374,20 @@ void GrooveJoint2DSW::solve(real_t p_step) {
 	}
 }
 
+void GrooveJoint2DSW::save_state(uint8_t *r_state) const {
+	memcpy(r_state, &jn_acc, sizeof(Vector2));
+}
+
+void GrooveJoint2DSW::load_state(const uint8_t *p_state, int p_size) {
+	if (p_size == 0) {
+		jn_acc = Vector2();
+		return;
+	}
+
+	ERR_FAIL_COND(p_size != (int)sizeof(Vector2));
+	memcpy(&jn_acc, p_state, sizeof(Vector2));
+}
+
 GrooveJoint2DSW::GrooveJoint2DSW(const Vector2 &p_a_groove1, const Vector2 &p_a_groove2, const Vector2 &p_b_anchor, Body2DSW *p_body_a, Body2DSW *p_body_b) :
 		Joint2DSW(_arr, 2) {
 	A = p_body_a;
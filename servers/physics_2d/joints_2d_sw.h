@@ -101,6 +101,10 @@ public:
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual int get_state_size() const override { return sizeof(Vector2); }
+	virtual void save_state(uint8_t *r_state) const override;
+	virtual void load_state(const uint8_t *p_state, int p_size) override;
+
 	void set_param(PhysicsServer2D::PinJointParam p_param, real_t p_value);
 	real_t get_param(PhysicsServer2D::PinJointParam p_param) const;
 
@@ -138,6 +142,10 @@ public:
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual int get_state_size() const override { return sizeof(Vector2); }
+	virtual void save_state(uint8_t *r_state) const override;
+	virtual void load_state(const uint8_t *p_state, int p_size) override;
+
 	GrooveJoint2DSW(const Vector2 &p_a_groove1, const Vector2 &p_a_groove2, const Vector2 &p_b_anchor, Body2DSW *p_body_a, Body2DSW *p_body_b);
 };
 
@@ -51,6 +51,7 @@ class PhysicsServer2DSW : public PhysicsServer2D {
 	int island_count;
 	int active_objects;
 	int collision_pairs;
+	uint64_t elapsed_time[Space2DSW::ELAPSED_TIME_MAX];
 
 	bool using_threads;
 
@@ -116,6 +117,12 @@ public:
 	virtual void space_set_param(RID p_space, SpaceParameter p_param, real_t p_value) override;
 	virtual real_t space_get_param(RID p_space, SpaceParameter p_param) const override;
 
+	virtual void space_set_deterministic(RID p_space, bool p_deterministic) override;
+	virtual bool space_is_deterministic(RID p_space) const override;
+
+	virtual Vector<uint8_t> space_save_snapshot(RID p_space) override;
+	virtual Error space_restore_snapshot(RID p_space, const Vector<uint8_t> &p_snapshot) override;
+
 	virtual void space_set_debug_contacts(RID p_space, int p_max_contacts) override;
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
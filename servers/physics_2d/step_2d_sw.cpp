@@ -38,6 +38,57 @@
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
 
+// Islands with at least this many constraints have their constraints spread over the work pool.
+#define ISLAND_BATCH_SOLVE_MIN_SIZE 1024
+// Smaller batches are solved on the calling thread.
+#define SOLVER_BATCH_MIN_SIZE 64
+#define SOLVER_COLOR_MAX 32
+
+void Step2DSW::_update_active_bodies(const SelfList<Body2DSW>::List *p_body_list) {
+	active_bodies.clear();
+
+	const SelfList<Body2DSW> *b = p_body_list->first();
+	while (b) {
+		active_bodies.push_back(b->self());
+		b = b->next();
+	}
+}
+
+void Step2DSW::_integrate_forces(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_forces(delta);
+}
+
+void Step2DSW::_integrate_velocities(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_velocities(delta);
+}
+
+void Step2DSW::_apply_integration() {
+	// Broadphase and space lists are not thread-safe, they are updated here after each threaded integration.
+	uint32_t body_count = active_bodies.size();
+	for (uint32_t body_index = 0; body_index < body_count; ++body_index) {
+		active_bodies[body_index]->apply_integration();
+	}
+}
+
+void Step2DSW::_setup_narrowphase_constraint(uint32_t p_constraint_index, void *p_userdata) {
+	Constraint2DSW *constraint = narrowphase_constraints[p_constraint_index];
+	constraint->set_setup_result(constraint->setup(delta));
+}
+
+bool Step2DSW::_add_island_constraint(Constraint2DSW *p_constraint, LocalVector<Constraint2DSW *> &p_constraint_island) {
+	if (p_constraint->get_setup_step() == _step) {
+		if (!p_constraint->get_setup_result()) {
+			// Already set up in the narrowphase and not colliding, nothing to solve.
+			return false;
+		}
+	} else {
+		all_constraints.push_back(p_constraint);
+	}
+
+	p_constraint_island.push_back(p_constraint);
+	return true;
+}
+
 void Step2DSW::_populate_island(Body2DSW *p_body, LocalVector<Body2DSW *> &p_body_island, LocalVector<Constraint2DSW *> &p_constraint_island) {
 	p_body->set_island_step(_step);
 
@@ -52,8 +103,9 @@ void Step2DSW::_populate_island(Body2DSW *p_body, LocalVector<Body2DSW *> &p_bod
 			continue; // Already processed.
 		}
 		constraint->set_island_step(_step);
-		p_constraint_island.push_back(constraint);
-		all_constraints.push_back(constraint);
+		if (!_add_island_constraint(constraint, p_constraint_island)) {
+			continue; // Doesn't connect bodies.
+		}
 
 		for (int i = 0; i < constraint->get_body_count(); i++) {
 			if (i == E->get().second) {
@@ -89,13 +141,123 @@ void Step2DSW::_pre_solve_island(LocalVector<Constraint2DSW *> &p_constraint_isl
 	p_constraint_island.resize(valid_constraint_count);
 }
 
-void Step2DSW::_solve_island(uint32_t p_island_index, void *p_userdata) const {
-	const LocalVector<Constraint2DSW *> &constraint_island = constraint_islands[p_island_index];
+void Step2DSW::_solve_island(uint32_t p_island_index, void *p_userdata) {
+	LocalVector<Constraint2DSW *> &constraint_island = constraint_islands[p_island_index];
+	if (constraint_island.size() >= ISLAND_BATCH_SOLVE_MIN_SIZE) {
+		return; // Solved afterwards with _solve_large_island().
+	}
+
+	_solve_constraints(constraint_island, false);
+}
+
+void Step2DSW::_solve_large_island(uint32_t p_island_index) {
+	LocalVector<Constraint2DSW *> &constraint_island = constraint_islands[p_island_index];
+	_solve_constraints(constraint_island, _color_island(constraint_island));
+}
+
+bool Step2DSW::_color_island(LocalVector<Constraint2DSW *> &p_constraint_island) {
+	uint32_t constraint_count = p_constraint_island.size();
+
+	for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+		Constraint2DSW *constraint = p_constraint_island[constraint_index];
+		for (int i = 0; i < constraint->get_body_count(); i++) {
+			constraint->get_body_ptr()[i]->set_solver_color_mask(0);
+		}
+	}
+
+	// Greedy coloring: constraints with the same color don't share any dynamic body, so each color can be solved in parallel.
+	// Constraints that don't fit in the available colors end up in an extra batch, solved on a single thread.
+	uint32_t color_sizes[SOLVER_COLOR_MAX + 1] = {};
+	constraint_colors.resize(constraint_count);
+
+	for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+		Constraint2DSW *constraint = p_constraint_island[constraint_index];
+		Body2DSW **bodies = constraint->get_body_ptr();
+		int body_count = constraint->get_body_count();
+
+		uint32_t used_colors = 0;
+		for (int i = 0; i < body_count; i++) {
+			if (bodies[i]->get_mode() > PhysicsServer2D::BODY_MODE_KINEMATIC) {
+				used_colors |= bodies[i]->get_solver_color_mask();
+			}
+		}
+
+		uint32_t color = 0;
+		while (color < SOLVER_COLOR_MAX && (used_colors & (1 << color))) {
+			++color;
+		}
+
+		if (color < SOLVER_COLOR_MAX) {
+			for (int i = 0; i < body_count; i++) {
+				if (bodies[i]->get_mode() > PhysicsServer2D::BODY_MODE_KINEMATIC) {
+					bodies[i]->set_solver_color_mask(bodies[i]->get_solver_color_mask() | (1 << color));
+				}
+			}
+		}
+
+		constraint_colors[constraint_index] = color;
+		++color_sizes[color];
+	}
+
+	// Sort constraints by color, keeping their relative order.
+	uint32_t color_offsets[SOLVER_COLOR_MAX + 1];
+	uint32_t offset = 0;
+	solver_batches.clear();
+	for (uint32_t color = 0; color <= SOLVER_COLOR_MAX; ++color) {
+		color_offsets[color] = offset;
+		offset += color_sizes[color];
+		if (color_sizes[color] > 0) {
+			solver_batches.push_back(offset);
+		}
+	}
+	solver_serial_batch_begin = color_offsets[SOLVER_COLOR_MAX];
+
+	colored_constraints.resize(constraint_count);
+	for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+		colored_constraints[color_offsets[constraint_colors[constraint_index]]++] = p_constraint_island[constraint_index];
+	}
+	for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+		p_constraint_island[constraint_index] = colored_constraints[constraint_index];
+	}
+
+	return true;
+}
+
+void Step2DSW::_solve_batch_constraint(uint32_t p_constraint_index, void *p_userdata) {
+	solver_batch[p_constraint_index]->solve(delta);
+}
+
+void Step2DSW::_solve_island_batches(LocalVector<Constraint2DSW *> &p_constraint_island) {
+	uint32_t batch_count = solver_batches.size();
+	for (int i = 0; i < iterations; i++) {
+		uint32_t batch_begin = 0;
+		for (uint32_t batch_index = 0; batch_index < batch_count; ++batch_index) {
+			uint32_t batch_end = solver_batches[batch_index];
+			uint32_t batch_size = batch_end - batch_begin;
+			if (batch_begin < solver_serial_batch_begin && batch_size >= SOLVER_BATCH_MIN_SIZE) {
+				solver_batch = p_constraint_island.ptr() + batch_begin;
+				_do_work(batch_size, &Step2DSW::_solve_batch_constraint);
+			} else {
+				for (uint32_t constraint_index = batch_begin; constraint_index < batch_end; ++constraint_index) {
+					p_constraint_island[constraint_index]->solve(delta);
+				}
+			}
+			batch_begin = batch_end;
+		}
+	}
+	solver_batch = nullptr;
+}
+
+void Step2DSW::_solve_constraints(LocalVector<Constraint2DSW *> &p_constraint_island, bool p_batched) {
+	if (p_batched) {
+		_solve_island_batches(p_constraint_island);
+		return;
+	}
 
 	for (int i = 0; i < iterations; i++) {
-		uint32_t constraint_count = constraint_island.size();
+		uint32_t constraint_count = p_constraint_island.size();
 		for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
-			constraint_island[constraint_index]->solve(delta);
+			p_constraint_island[constraint_index]->solve(delta);
 		}
 	}
 }
@@ -129,6 +291,8 @@ void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 
 	p_space->setup(); //update inertias, etc
 
+	single_threaded = p_space->is_deterministic();
+
 	iterations = p_iterations;
 	delta = p_delta;
 
@@ -139,14 +303,16 @@ void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
 	uint64_t profile_endtime = 0;
 
-	int active_count = 0;
+	_update_active_bodies(body_list);
 
-	const SelfList<Body2DSW> *b = body_list->first();
-	while (b) {
-		b->self()->integrate_forces(p_delta);
-		b = b->next();
-		active_count++;
-	}
+	uint32_t body_count = active_bodies.size();
+	_do_work(body_count, &Step2DSW::_integrate_forces);
+	_apply_integration();
+
+	// Continuous collision detection extends shapes by their motion, pair them before the narrowphase.
+	p_space->update();
+
+	int active_count = (int)body_count;
 
 	p_space->set_active_objects(active_count);
 
@@ -156,6 +322,32 @@ void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 		profile_begtime = profile_endtime;
 	}
 
+	/* NARROWPHASE */
+
+	// Constraints of active bodies are set up first, so islands only connect bodies that actually collide.
+	narrowphase_constraints.clear();
+	for (uint32_t body_index = 0; body_index < body_count; ++body_index) {
+		const List<Pair<Constraint2DSW *, int>> &constraint_list = active_bodies[body_index]->get_constraint_list();
+		for (const List<Pair<Constraint2DSW *, int>>::Element *E = constraint_list.front(); E; E = E->next()) {
+			Constraint2DSW *constraint = E->get().first;
+			if (constraint->get_setup_step() == _step) {
+				continue; // Already added.
+			}
+			constraint->set_setup_step(_step);
+			narrowphase_constraints.push_back(constraint);
+		}
+	}
+
+	_do_work(narrowphase_constraints.size(), &Step2DSW::_setup_narrowphase_constraint);
+
+	uint64_t narrowphase_time = 0;
+
+	{ //profile
+		profile_endtime = OS::get_singleton()->get_ticks_usec();
+		narrowphase_time = profile_endtime - profile_begtime;
+		profile_begtime = profile_endtime;
+	}
+
 	/* GENERATE CONSTRAINT ISLANDS FOR MOVING AREAS */
 
 	uint32_t island_count = 0;
@@ -178,15 +370,16 @@ void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 			LocalVector<Constraint2DSW *> &constraint_island = constraint_islands[island_count - 1];
 			constraint_island.clear();
 
-			all_constraints.push_back(constraint);
-			constraint_island.push_back(constraint);
+			if (!_add_island_constraint(constraint, constraint_island)) {
+				--island_count;
+			}
 		}
 		p_space->area_remove_from_moved_list((SelfList<Area2DSW> *)aml.first()); //faster to remove here
 	}
 
 	/* GENERATE CONSTRAINT ISLANDS FOR ACTIVE RIGID BODIES */
 
-	b = body_list->first();
+	const SelfList<Body2DSW> *b = body_list->first();
 
 	uint32_t body_island_count = 0;
 
@@ -234,18 +427,25 @@ void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_contraint_count = all_constraints.size();
-	work_pool.do_work(total_contraint_count, this, &Step2DSW::_setup_contraint, nullptr);
+	_do_work(total_contraint_count, &Step2DSW::_setup_contraint);
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
-		p_space->set_elapsed_time(Space2DSW::ELAPSED_TIME_SETUP_CONSTRAINTS, profile_endtime - profile_begtime);
+		p_space->set_elapsed_time(Space2DSW::ELAPSED_TIME_SETUP_CONSTRAINTS, narrowphase_time + profile_endtime - profile_begtime);
 		profile_begtime = profile_endtime;
 	}
 
 	/* PRE-SOLVE CONSTRAINT ISLANDS */
 
+	// Islands follow the bodies' constraint lists, which are in pair creation order.
+	// In deterministic mode they are sorted, so warm starting and solving always happen in the same order.
+	bool deterministic = p_space->is_deterministic();
+
 	// Warning: This doesn't run on threads, because it involves thread-unsafe processing.
 	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
+		if (deterministic) {
+			constraint_islands[island_index].sort_custom<Constraint2DSW::KeyComparator>();
+		}
 		_pre_solve_island(constraint_islands[island_index]);
 	}
 
@@ -254,11 +454,18 @@ void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 	// Warning: _solve_island modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
 	if (island_count > 1) {
-		work_pool.do_work(island_count, this, &Step2DSW::_solve_island, nullptr);
+		_do_work(island_count, &Step2DSW::_solve_island);
 	} else if (island_count > 0) {
 		_solve_island(0);
 	}
 
+	// Large islands are skipped above, each is solved in turn using the whole work pool.
+	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
+		if (constraint_islands[island_index].size() >= ISLAND_BATCH_SOLVE_MIN_SIZE) {
+			_solve_large_island(island_index);
+		}
+	}
+
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(Space2DSW::ELAPSED_TIME_SOLVE_CONSTRAINTS, profile_endtime - profile_begtime);
@@ -267,12 +474,11 @@ void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 
 	/* INTEGRATE VELOCITIES */
 
-	b = body_list->first();
-	while (b) {
-		const SelfList<Body2DSW> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
-		b = n; // in case it shuts itself down
-	}
+	// Refreshed because bodies can be woken up while solving.
+	_update_active_bodies(body_list);
+
+	_do_work(active_bodies.size(), &Step2DSW::_integrate_velocities);
+	_apply_integration();
 
 	/* SLEEP / WAKE UP ISLANDS */
 
@@ -298,6 +504,7 @@ Step2DSW::Step2DSW() {
 
 	body_islands.reserve(BODY_ISLAND_COUNT_RESERVE);
 	constraint_islands.reserve(ISLAND_COUNT_RESERVE);
+	narrowphase_constraints.reserve(CONSTRAINT_COUNT_RESERVE);
 	all_constraints.reserve(CONSTRAINT_COUNT_RESERVE);
 
 	work_pool.init();
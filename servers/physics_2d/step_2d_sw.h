@@ -43,19 +43,55 @@ class Step2DSW {
 	real_t delta = 0.0;
 
 	ThreadWorkPool work_pool;
+	// Deterministic spaces are stepped on the calling thread only, so thread scheduling can't change the results.
+	bool single_threaded = false;
 
+	LocalVector<Body2DSW *> active_bodies;
 	LocalVector<LocalVector<Body2DSW *>> body_islands;
 	LocalVector<LocalVector<Constraint2DSW *>> constraint_islands;
+	LocalVector<Constraint2DSW *> narrowphase_constraints;
 	LocalVector<Constraint2DSW *> all_constraints;
 
+	LocalVector<uint32_t> constraint_colors;
+	LocalVector<Constraint2DSW *> colored_constraints;
+	LocalVector<uint32_t> solver_batches;
+	uint32_t solver_serial_batch_begin = 0;
+	Constraint2DSW **solver_batch = nullptr;
+
+	template <class M>
+	void _do_work(uint32_t p_count, M p_method) {
+		if (single_threaded) {
+			for (uint32_t i = 0; i < p_count; i++) {
+				(this->*p_method)(i, nullptr);
+			}
+		} else {
+			work_pool.do_work(p_count, this, p_method, nullptr);
+		}
+	}
+
+	void _update_active_bodies(const SelfList<Body2DSW>::List *p_body_list);
+	void _integrate_forces(uint32_t p_body_index, void *p_userdata = nullptr);
+	void _integrate_velocities(uint32_t p_body_index, void *p_userdata = nullptr);
+	void _apply_integration();
 	void _populate_island(Body2DSW *p_body, LocalVector<Body2DSW *> &p_body_island, LocalVector<Constraint2DSW *> &p_constraint_island);
+	void _setup_narrowphase_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
+	bool _add_island_constraint(Constraint2DSW *p_constraint, LocalVector<Constraint2DSW *> &p_constraint_island);
 	void _setup_contraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<Constraint2DSW *> &p_constraint_island) const;
-	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr) const;
+	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
+	void _solve_large_island(uint32_t p_island_index);
+	bool _color_island(LocalVector<Constraint2DSW *> &p_constraint_island);
+	void _solve_batch_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
+	void _solve_island_batches(LocalVector<Constraint2DSW *> &p_constraint_island);
+	void _solve_constraints(LocalVector<Constraint2DSW *> &p_constraint_island, bool p_batched);
 	void _check_suspend(LocalVector<Body2DSW *> &p_body_island) const;
 
 public:
 	void step(Space2DSW *p_space, real_t p_delta, int p_iterations);
+
+	// Also used by direct space state queries, which only run while no space is being stepped.
+	ThreadWorkPool &get_work_pool() { return work_pool; }
+
 	Step2DSW();
 	~Step2DSW();
 };
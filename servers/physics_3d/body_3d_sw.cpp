@@ -278,12 +278,14 @@ void Body3DSW::set_state(PhysicsServer3D::BodyState p_state, const Variant &p_va
 				if (first_time_kinematic) {
 					_set_transform(p_variant);
 					_set_inv_transform(get_transform().affine_inverse());
+					previous_transform = get_transform();
 					first_time_kinematic = false;
 				}
 
 			} else if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
 				_set_transform(p_variant);
 				_set_inv_transform(get_transform().affine_inverse());
+				previous_transform = get_transform();
 				wakeup_neighbours();
 			} else {
 				Transform t = p_variant;
@@ -294,6 +296,7 @@ void Body3DSW::set_state(PhysicsServer3D::BodyState p_state, const Variant &p_va
 				}
 				_set_transform(t);
 				_set_inv_transform(get_transform().inverse());
+				previous_transform = get_transform(); // Teleported, nothing to interpolate from.
 			}
 			wakeup();
 
@@ -481,6 +484,7 @@ void Body3DSW::integrate_forces(real_t p_step) {
 	*/
 
 	Vector3 motion;
+	real_t angle = 0;
 	bool do_motion = false;
 
 	if (mode == PhysicsServer3D::BODY_MODE_KINEMATIC) {
@@ -526,6 +530,7 @@ void Body3DSW::integrate_forces(real_t p_step) {
 
 		if (continuous_cd) {
 			motion = linear_velocity * p_step;
+			angle = angular_velocity.length() * p_step;
 			do_motion = true;
 		}
 	}
@@ -540,7 +545,8 @@ void Body3DSW::integrate_forces(real_t p_step) {
 	biased_linear_velocity = Vector3();
 
 	if (do_motion) { //shapes temporarily extend for raycast
-		_update_shapes_with_motion(motion);
+		_update_shape_aabbs_with_motion(motion, angle, get_transform().origin + center_of_mass);
+		broadphase_update_pending = true;
 	}
 
 	def_area = nullptr; // clear the area, so it is set in the next frame
@@ -553,9 +559,11 @@ void Body3DSW::integrate_velocities(real_t p_step) {
 	}
 
 	if (fi_callback) {
-		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+		state_query_pending = true;
 	}
 
+	previous_transform = get_transform();
+
 	//apply axis lock linear
 	for (int i = 0; i < 3; i++) {
 		if (is_axis_locked((PhysicsServer3D::BodyAxis)(1 << i))) {
@@ -576,7 +584,7 @@ void Body3DSW::integrate_velocities(real_t p_step) {
 		_set_transform(new_transform, false);
 		_set_inv_transform(new_transform.affine_inverse());
 		if (contacts.size() == 0 && linear_velocity == Vector3() && angular_velocity == Vector3()) {
-			set_active(false); //stopped moving, deactivate
+			deactivation_pending = true; //stopped moving, deactivate
 		}
 
 		return;
@@ -605,9 +613,12 @@ void Body3DSW::integrate_velocities(real_t p_step) {
 
 	transform.origin += total_linear_velocity * p_step;
 
-	_set_transform(transform);
+	_set_transform(transform, false);
 	_set_inv_transform(get_transform().inverse());
 
+	_update_shape_aabbs();
+	broadphase_update_pending = true;
+
 	_update_transform_dependant();
 
 	/*
@@ -616,6 +627,23 @@ void Body3DSW::integrate_velocities(real_t p_step) {
 	*/
 }
 
+void Body3DSW::apply_integration() {
+	if (broadphase_update_pending) {
+		_update_broadphase();
+		broadphase_update_pending = false;
+	}
+
+	if (state_query_pending) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+		state_query_pending = false;
+	}
+
+	if (deactivation_pending) {
+		set_active(false);
+		deactivation_pending = false;
+	}
+}
+
 /*
 void BodySW::simulate_motion(const Transform& p_xform,real_t p_step) {
 	Transform inv_xform = p_xform.affine_inverse();
@@ -648,6 +676,38 @@ void BodySW::simulate_motion(const Transform& p_xform,real_t p_step) {
 
 */
 
+void Body3DSW::save_state(State &r_state) const {
+	r_state.transform = get_transform();
+	r_state.inv_transform = get_inv_transform();
+	r_state.previous_transform = previous_transform;
+	r_state.new_transform = new_transform;
+	r_state.linear_velocity = linear_velocity;
+	r_state.angular_velocity = angular_velocity;
+	r_state.applied_force = applied_force;
+	r_state.applied_torque = applied_torque;
+	r_state.still_time = still_time;
+	r_state.active = active;
+}
+
+void Body3DSW::load_state(const State &p_state) {
+	_set_transform(p_state.transform);
+	_set_inv_transform(p_state.inv_transform);
+	previous_transform = p_state.previous_transform;
+	new_transform = p_state.new_transform;
+	linear_velocity = p_state.linear_velocity;
+	angular_velocity = p_state.angular_velocity;
+	applied_force = p_state.applied_force;
+	applied_torque = p_state.applied_torque;
+	still_time = p_state.still_time;
+	_update_transform_dependant();
+	set_active(p_state.active);
+
+	// Moved outside of a step, the node must still receive the restored state.
+	if (fi_callback && !direct_state_query_list.in_list()) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+}
+
 void Body3DSW::wakeup_neighbours() {
 	for (Map<Constraint3DSW *, int>::Element *E = constraint_map.front(); E; E = E->next()) {
 		const Constraint3DSW *c = E->key();
@@ -745,8 +805,12 @@ Body3DSW::Body3DSW() :
 	omit_force_integration = false;
 	//applied_torque=0;
 	island_step = 0;
+	solver_color_mask = 0;
 	first_time_kinematic = false;
 	first_integration = false;
+	broadphase_update_pending = false;
+	state_query_pending = false;
+	deactivation_pending = false;
 	_set_static(false);
 
 	contact_count = 0;
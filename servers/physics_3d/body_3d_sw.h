@@ -91,9 +91,15 @@ class Body3DSW : public CollisionObject3DSW {
 	bool continuous_cd;
 	bool can_sleep;
 	bool first_time_kinematic;
+
+	// Work left by the integration steps, which can run on worker threads.
+	bool broadphase_update_pending;
+	bool state_query_pending;
+	bool deactivation_pending;
 	void _update_inertia();
 	virtual void _shapes_changed();
 	Transform new_transform;
+	Transform previous_transform;
 
 	Map<Constraint3DSW *, int> constraint_map;
 
@@ -134,6 +140,7 @@ class Body3DSW : public CollisionObject3DSW {
 	ForceIntegrationCallback *fi_callback;
 
 	uint64_t island_step;
+	uint32_t solver_color_mask;
 
 	_FORCE_INLINE_ void _compute_area_gravity_and_dampenings(const Area3DSW *p_area);
 
@@ -183,9 +190,14 @@ public:
 	_FORCE_INLINE_ bool has_exception(const RID &p_exception) const { return exceptions.has(p_exception); }
 	_FORCE_INLINE_ const VSet<RID> &get_exceptions() const { return exceptions; }
 
+	_FORCE_INLINE_ const Transform &get_previous_transform() const { return previous_transform; }
+
 	_FORCE_INLINE_ uint64_t get_island_step() const { return island_step; }
 	_FORCE_INLINE_ void set_island_step(uint64_t p_step) { island_step = p_step; }
 
+	_FORCE_INLINE_ uint32_t get_solver_color_mask() const { return solver_color_mask; }
+	_FORCE_INLINE_ void set_solver_color_mask(uint32_t p_mask) { solver_color_mask = p_mask; }
+
 	_FORCE_INLINE_ void add_constraint(Constraint3DSW *p_constraint, int p_pos) { constraint_map[p_constraint] = p_pos; }
 	_FORCE_INLINE_ void remove_constraint(Constraint3DSW *p_constraint) { constraint_map.erase(p_constraint); }
 	const Map<Constraint3DSW *, int> &get_constraint_map() const { return constraint_map; }
@@ -290,8 +302,28 @@ public:
 	void set_axis_lock(PhysicsServer3D::BodyAxis p_axis, bool lock);
 	bool is_axis_locked(PhysicsServer3D::BodyAxis p_axis) const;
 
+	// Safe to call from worker threads for different bodies,
+	// the shared space data is updated afterwards in apply_integration().
 	void integrate_forces(real_t p_step);
 	void integrate_velocities(real_t p_step);
+	void apply_integration();
+
+	// Simulation state, saved in space snapshots.
+	struct State {
+		Transform transform;
+		Transform inv_transform;
+		Transform previous_transform;
+		Transform new_transform;
+		Vector3 linear_velocity;
+		Vector3 angular_velocity;
+		Vector3 applied_force;
+		Vector3 applied_torque;
+		real_t still_time;
+		bool active;
+	};
+
+	void save_state(State &r_state) const;
+	void load_state(const State &p_state);
 
 	_FORCE_INLINE_ Vector3 get_velocity_in_local_point(const Vector3 &rel_pos) const {
 		return linear_velocity + angular_velocity.cross(rel_pos - center_of_mass);
@@ -392,6 +424,7 @@ public:
 
 	virtual void set_transform(const Transform &p_transform) override { body->set_state(PhysicsServer3D::BODY_STATE_TRANSFORM, p_transform); }
 	virtual Transform get_transform() const override { return body->get_transform(); }
+	virtual Transform get_previous_transform() const override { return body->get_previous_transform(); }
 
 	virtual void add_central_force(const Vector3 &p_force) override { body->add_central_force(p_force); }
 	virtual void add_force(const Vector3 &p_force, const Vector3 &p_position = Vector3()) override {
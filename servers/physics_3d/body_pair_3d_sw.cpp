@@ -48,6 +48,7 @@
 #define RELAXATION_TIMESTEPS 3
 #define MIN_VELOCITY 0.0001
 #define MAX_BIAS_ROTATION (Math_PI / 8)
+#define CCD_MAX_ITERATIONS 16
 
 void BodyPair3DSW::_contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, void *p_userdata) {
 	BodyPair3DSW *pair = (BodyPair3DSW *)p_userdata;
@@ -82,15 +83,20 @@ void BodyPair3DSW::contact_added_callback(const Vector3 &p_point_A, int p_index_
 
 	// attempt to determine if the contact will be reused
 	real_t contact_recycle_radius = space->get_contact_recycle_radius();
+	// contacts coming from the same features can slide further and still be the same contact
+	real_t feature_recycle_radius = MAX(contact_recycle_radius, space->get_contact_max_separation());
+	bool has_feature = match_features && p_index_A != 0;
 
 	for (int i = 0; i < contact_count; i++) {
 		Contact &c = contacts[i];
-		if (c.local_A.distance_squared_to(local_A) < (contact_recycle_radius * contact_recycle_radius) &&
-				c.local_B.distance_squared_to(local_B) < (contact_recycle_radius * contact_recycle_radius)) {
+		real_t radius = (has_feature && c.index_A == p_index_A && c.index_B == p_index_B) ? feature_recycle_radius : contact_recycle_radius;
+		if (c.local_A.distance_squared_to(local_A) < (radius * radius) &&
+				c.local_B.distance_squared_to(local_B) < (radius * radius)) {
 			contact.acc_normal_impulse = c.acc_normal_impulse;
 			contact.acc_bias_impulse = c.acc_bias_impulse;
 			contact.acc_bias_impulse_center_of_mass = c.acc_bias_impulse_center_of_mass;
-			contact.acc_tangent_impulse = c.acc_tangent_impulse;
+			// keep only the part of the friction impulse that lies in the new tangent plane
+			contact.acc_tangent_impulse = c.acc_tangent_impulse - contact.normal * contact.normal.dot(c.acc_tangent_impulse);
 			new_index = i;
 			break;
 		}
@@ -99,30 +105,13 @@ void BodyPair3DSW::contact_added_callback(const Vector3 &p_point_A, int p_index_
 	// figure out if the contact amount must be reduced to fit the new contact
 
 	if (new_index == MAX_CONTACTS) {
-		// remove the contact with the minimum depth
+		int removed = _find_contact_to_remove(contact);
 
-		int least_deep = -1;
-		real_t min_depth = 1e10;
+		ERR_FAIL_COND(removed == -1);
 
-		for (int i = 0; i <= contact_count; i++) {
-			Contact &c = (i == contact_count) ? contact : contacts[i];
-			Vector3 global_A = A->get_transform().basis.xform(c.local_A);
-			Vector3 global_B = B->get_transform().basis.xform(c.local_B) + offset_B;
+		if (removed < contact_count) { //replace the removed contact by the new one
 
-			Vector3 axis = global_A - global_B;
-			real_t depth = axis.dot(c.normal);
-
-			if (depth < min_depth) {
-				min_depth = depth;
-				least_deep = i;
-			}
-		}
-
-		ERR_FAIL_COND(least_deep == -1);
-
-		if (least_deep < contact_count) { //replace the last deep contact by the new one
-
-			contacts[least_deep] = contact;
+			contacts[removed] = contact;
 		}
 
 		return;
@@ -135,6 +124,64 @@ void BodyPair3DSW::contact_added_callback(const Vector3 &p_point_A, int p_index_
 	}
 }
 
+static inline real_t _contact_area_squared(const Vector3 &p_a, const Vector3 &p_b, const Vector3 &p_c, const Vector3 &p_d) {
+	// The points are unordered, use the largest of the three possible quads.
+	real_t area = (p_a - p_b).cross(p_c - p_d).length_squared();
+	area = MAX(area, (p_a - p_c).cross(p_b - p_d).length_squared());
+	area = MAX(area, (p_a - p_d).cross(p_b - p_c).length_squared());
+	return area;
+}
+
+int BodyPair3DSW::_find_contact_to_remove(const Contact &p_new_contact) const {
+	// Keep the deepest contact, then remove the one that leaves the widest manifold, so it stays stable under stacking.
+	static_assert(MAX_CONTACTS == 4, "The remaining contacts are measured as a quad.");
+
+	Vector3 points[MAX_CONTACTS + 1];
+	int deepest = -1;
+	real_t max_depth = -1e10;
+
+	for (int i = 0; i <= contact_count; i++) {
+		const Contact &c = (i == contact_count) ? p_new_contact : contacts[i];
+		Vector3 global_A = A->get_transform().basis.xform(c.local_A);
+		Vector3 global_B = B->get_transform().basis.xform(c.local_B) + offset_B;
+
+		Vector3 axis = global_A - global_B;
+		real_t depth = axis.dot(c.normal);
+
+		if (depth > max_depth) {
+			max_depth = depth;
+			deepest = i;
+		}
+
+		points[i] = global_A;
+	}
+
+	int removed = -1;
+	real_t max_area = -1;
+
+	for (int i = 0; i <= contact_count; i++) {
+		if (i == deepest) {
+			continue;
+		}
+
+		Vector3 remaining[MAX_CONTACTS];
+		int remaining_count = 0;
+		for (int j = 0; j <= contact_count; j++) {
+			if (j != i) {
+				remaining[remaining_count++] = points[j];
+			}
+		}
+
+		real_t area = _contact_area_squared(remaining[0], remaining[1], remaining[2], remaining[3]);
+		if (area > max_area) {
+			max_area = area;
+			removed = i;
+		}
+	}
+
+	return removed;
+}
+
 void BodyPair3DSW::validate_contacts() {
 	//make sure to erase contacts that are no longer valid
 
@@ -161,46 +208,105 @@ void BodyPair3DSW::validate_contacts() {
 	}
 }
 
-bool BodyPair3DSW::_test_ccd(real_t p_step, Body3DSW *p_A, int p_shape_A, const Transform &p_xform_A, Body3DSW *p_B, int p_shape_B, const Transform &p_xform_B) {
+static void _ccd_face_found(void *p_userdata, Shape3DSW *p_convex) {
+	*(bool *)p_userdata = true;
+}
+
+real_t BodyPair3DSW::_test_ccd(real_t p_step, Body3DSW *p_A, int p_shape_A, const Transform &p_xform_A, Body3DSW *p_B, int p_shape_B, const Transform &p_xform_B) {
+	Shape3DSW *shape_A_ptr = p_A->get_shape(p_shape_A);
+	Shape3DSW *shape_B_ptr = p_B->get_shape(p_shape_B);
+
+	if (shape_A_ptr->is_concave()) {
+		return 1.0;
+	}
+
 	Vector3 motion = p_A->get_linear_velocity() * p_step;
 	real_t mlen = motion.length();
-	if (mlen < CMP_EPSILON) {
-		return false;
+
+	// the body rotates around its center of mass, bound how far any point of the shape can go because of it
+	AABB shape_aabb = p_xform_A.xform(shape_A_ptr->get_aabb());
+	Vector3 body_origin = p_xform_A.origin - p_A->get_transform().basis.xform(p_A->get_shape_transform(p_shape_A).origin);
+	Vector3 center_of_mass = body_origin + p_A->get_center_of_mass();
+
+	real_t radius = 0;
+	for (int i = 0; i < 8; i++) {
+		radius = MAX(radius, shape_aabb.get_endpoint(i).distance_to(center_of_mass));
 	}
 
-	Vector3 mnormal = motion / mlen;
+	Vector3 angular_velocity = p_A->get_angular_velocity();
+	real_t angle = angular_velocity.length() * p_step;
+	real_t angular_motion = angle * radius;
 
-	real_t min, max;
-	p_A->get_shape(p_shape_A)->project_range(mnormal, p_xform_A, min, max);
-	bool fast_object = mlen > (max - min) * 0.3; //going too fast in that direction
+	if (mlen + angular_motion <= shape_aabb.get_shortest_axis_size() * 0.3) { //did it move enough to even attempt a cast? let's say it should move more than 1/3 the size of the object
+		return 1.0;
+	}
 
-	if (!fast_object) { //did it move enough in this direction to even attempt raycast? let's say it should move more than 1/3 the size of the object in that axis
-		return false;
+	Vector3 rotation_axis;
+	if (angle > CMP_EPSILON) {
+		rotation_axis = angular_velocity.normalized();
 	}
 
-	//cast a segment from support in motion normal, in the same direction of motion by motion length
-	//support is the worst case collision point, so real collision happened before
-	Vector3 s = p_A->get_shape(p_shape_A)->get_support(p_xform_A.basis.xform(mnormal).normalized());
-	Vector3 from = p_xform_A.xform(s);
-	Vector3 to = from + motion;
+	AABB motion_aabb = shape_aabb.merge(AABB(shape_aabb.position + motion, shape_aabb.size)).grow(angular_motion);
 
-	Transform from_inv = p_xform_B.affine_inverse();
+	if (shape_B_ptr->is_concave()) {
+		// the distance to a concave shape is only known when some of its faces are close enough
+		bool face_found = false;
+		static_cast<ConcaveShape3DSW *>(shape_B_ptr)->cull(p_xform_B.affine_inverse().xform(motion_aabb), _ccd_face_found, &face_found);
+		if (!face_found) {
+			return 1.0;
+		}
+	}
+	real_t tolerance = shape_aabb.get_shortest_axis_size() * 0.01;
+
+	// Conservative advancement: move the shape along its motion by the distance to B divided by the fastest
+	// any of its points can approach B, this never goes past the time of impact.
+	real_t toi = 0;
+	Transform xform = p_xform_A;
+
+	for (int i = 0; i < CCD_MAX_ITERATIONS; i++) {
+		Vector3 point_A, point_B;
+		if (!CollisionSolver3DSW::solve_distance(shape_A_ptr, xform, shape_B_ptr, p_xform_B, point_A, point_B, motion_aabb)) {
+			if (i == 0) {
+				return 1.0; // already touching, regular contacts handle it
+			}
+			break;
+		}
 
-	Vector3 local_from = from_inv.xform(from - mnormal * mlen * 0.1); //start from a little inside the bounding box
-	Vector3 local_to = from_inv.xform(to);
+		Vector3 separation = point_B - point_A;
+		real_t distance = separation.length();
+		if (distance <= CMP_EPSILON) {
+			break;
+		}
 
-	Vector3 rpos, rnorm;
-	if (!p_B->get_shape(p_shape_B)->intersect_segment(local_from, local_to, rpos, rnorm)) {
-		return false;
-	}
+		// check the approach before stopping close to B, a body moving away from it must keep its velocity
+		real_t approach = motion.dot(separation / distance) + angular_motion;
+		if (approach < CMP_EPSILON) {
+			return 1.0; // moving away
+		}
 
-	//shorten the linear velocity so it does not hit, but gets close enough, next frame will hit softly or soft enough
-	Vector3 hitpos = p_xform_B.xform(rpos);
+		if (distance < tolerance) {
+			break;
+		}
 
-	real_t newlen = hitpos.distance_to(from) - (max - min) * 0.01;
-	p_A->set_linear_velocity((mnormal * newlen) / p_step);
+		toi += distance / approach;
+		if (toi >= 1) {
+			return 1.0; // doesn't reach B during this step
+		}
 
-	return true;
+		xform = p_xform_A;
+		if (angle > CMP_EPSILON) {
+			Basis rotation(rotation_axis, angle * toi);
+			xform.basis = rotation * xform.basis;
+			xform.origin = center_of_mass + rotation.xform(xform.origin - center_of_mass);
+		}
+		xform.origin += motion * toi;
+	}
+
+	if (toi == 0) {
+		return 1.0; // close to B from the start of the step, regular contacts handle it
+	}
+
+	return toi;
 }
 
 real_t combine_bounce(Body3DSW *A, Body3DSW *B) {
@@ -212,6 +318,9 @@ real_t combine_friction(Body3DSW *A, Body3DSW *B) {
 }
 
 bool BodyPair3DSW::setup(real_t p_step) {
+	ccd_body = nullptr;
+	ccd_toi = 1.0;
+
 	dynamic_A = (A->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC);
 	dynamic_B = (B->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC);
 
@@ -250,17 +359,22 @@ bool BodyPair3DSW::setup(real_t p_step) {
 	Shape3DSW *shape_A_ptr = A->get_shape(shape_A);
 	Shape3DSW *shape_B_ptr = B->get_shape(shape_B);
 
+	// Concave shapes report contacts of several faces, with the same feature indices.
+	match_features = !shape_A_ptr->is_concave() && !shape_B_ptr->is_concave();
+
 	collided = CollisionSolver3DSW::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
 
 	if (!collided) {
-		//test ccd (currently just a raycast)
+		//test ccd, casting the shape with conservative advancement
 
 		if (A->is_continuous_collision_detection_enabled() && dynamic_A && !dynamic_B) {
-			_test_ccd(p_step, A, shape_A, xform_A, B, shape_B, xform_B);
+			ccd_body = A;
+			ccd_toi = _test_ccd(p_step, A, shape_A, xform_A, B, shape_B, xform_B);
 		}
 
 		if (B->is_continuous_collision_detection_enabled() && dynamic_B && !dynamic_A) {
-			_test_ccd(p_step, B, shape_B, xform_B, A, shape_A, xform_A);
+			ccd_body = B;
+			ccd_toi = _test_ccd(p_step, B, shape_B, xform_B, A, shape_A, xform_A);
 		}
 
 		return false;
@@ -517,10 +631,44 @@ BodyPair3DSW::BodyPair3DSW(Body3DSW *p_A, int p_shape_A, Body3DSW *p_B, int p_sh
 	shape_A = p_shape_A;
 	shape_B = p_shape_B;
 	space = A->get_space();
+	set_key(A->get_self().get_id(), B->get_self().get_id(), ((uint64_t)(uint32_t)shape_A << 32) | (uint32_t)shape_B);
 	A->add_constraint(this, 0);
 	B->add_constraint(this, 1);
 }
 
+int BodyPair3DSW::get_state_size() const {
+	return sizeof(State) + contact_count * sizeof(Contact);
+}
+
+void BodyPair3DSW::save_state(uint8_t *r_state) const {
+	State state;
+	state.sep_axis = sep_axis;
+	state.contact_count = contact_count;
+	state.collided = collided;
+	memcpy(r_state, &state, sizeof(State));
+	memcpy(r_state + sizeof(State), contacts, contact_count * sizeof(Contact));
+}
+
+void BodyPair3DSW::load_state(const uint8_t *p_state, int p_size) {
+	if (p_size == 0) {
+		sep_axis = Vector3();
+		contact_count = 0;
+		collided = false;
+		return;
+	}
+
+	ERR_FAIL_COND(p_size < (int)sizeof(State));
+	State state;
+	memcpy(&state, p_state, sizeof(State));
+	ERR_FAIL_COND(state.contact_count < 0 || state.contact_count > MAX_CONTACTS);
+	ERR_FAIL_COND(p_size != (int)(sizeof(State) + state.contact_count * sizeof(Contact)));
+
+	sep_axis = state.sep_axis;
+	contact_count = state.contact_count;
+	collided = state.collided;
+	memcpy(contacts, p_state + sizeof(State), contact_count * sizeof(Contact));
+}
+
 BodyPair3DSW::~BodyPair3DSW() {
 	A->remove_constraint(this);
 	B->remove_constraint(this);
@@ -849,6 +997,7 @@ BodySoftBodyPair3DSW::BodySoftBodyPair3DSW(Body3DSW *p_A, int p_shape_A, SoftBod
 	soft_body = p_B;
 	body_shape = p_shape_A;
 	space = p_A->get_space();
+	set_key(body->get_self().get_id(), soft_body->get_self().get_id(), (uint32_t)body_shape);
 	body->add_constraint(this, 0);
 	soft_body->add_constraint(this);
 }
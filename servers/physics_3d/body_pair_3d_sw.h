@@ -93,18 +93,39 @@ class BodyPair3DSW : public BodyContact3DSW {
 	Contact contacts[MAX_CONTACTS];
 	int contact_count = 0;
 
+	// Set by continuous collision detection, see get_time_of_impact().
+	Body3DSW *ccd_body = nullptr;
+	real_t ccd_toi = 1.0;
+
+	// Contact indices identify the features the contacts come from, only reliable when neither shape is concave.
+	bool match_features = false;
+
+	// Saved in space snapshots, followed by the contacts.
+	struct State {
+		Vector3 sep_axis;
+		int contact_count;
+		bool collided;
+	};
+
 	static void _contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, void *p_userdata);
 
 	void contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B);
 
 	void validate_contacts();
-	bool _test_ccd(real_t p_step, Body3DSW *p_A, int p_shape_A, const Transform &p_xform_A, Body3DSW *p_B, int p_shape_B, const Transform &p_xform_B);
+	int _find_contact_to_remove(const Contact &p_new_contact) const;
+	real_t _test_ccd(real_t p_step, Body3DSW *p_A, int p_shape_A, const Transform &p_xform_A, Body3DSW *p_B, int p_shape_B, const Transform &p_xform_B);
 
 public:
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual real_t get_time_of_impact(const Body3DSW *p_body) const override { return p_body == ccd_body ? ccd_toi : 1.0; }
+
+	virtual int get_state_size() const override;
+	virtual void save_state(uint8_t *r_state) const override;
+	virtual void load_state(const uint8_t *p_state, int p_size) override;
+
 	BodyPair3DSW(Body3DSW *p_A, int p_shape_A, Body3DSW *p_B, int p_shape_B);
 	~BodyPair3DSW();
 };
@@ -144,6 +144,20 @@ void CollisionObject3DSW::_update_shapes() {
 		return;
 	}
 
+	_update_shape_aabbs();
+	_update_broadphase();
+}
+
+void CollisionObject3DSW::_update_shapes_with_motion(const Vector3 &p_motion) {
+	if (!space) {
+		return;
+	}
+
+	_update_shape_aabbs_with_motion(p_motion);
+	_update_broadphase();
+}
+
+void CollisionObject3DSW::_update_shape_aabbs() {
 	for (int i = 0; i < shapes.size(); i++) {
 		Shape &s = shapes.write[i];
 
@@ -156,17 +170,34 @@ void CollisionObject3DSW::_update_shapes() {
 
 		Vector3 scale = xform.get_basis().get_scale();
 		s.area_cache = s.shape->get_area() * scale.x * scale.y * scale.z;
+	}
+}
 
-		if (s.bpid == 0) {
-			s.bpid = space->get_broadphase()->create(this, i, shape_aabb, _static);
-			space->get_broadphase()->set_static(s.bpid, _static);
+void CollisionObject3DSW::_update_shape_aabbs_with_motion(const Vector3 &p_motion, real_t p_angle, const Vector3 &p_center) {
+	for (int i = 0; i < shapes.size(); i++) {
+		Shape &s = shapes.write[i];
+
+		//not quite correct, should compute the next matrix..
+		AABB shape_aabb = s.shape->get_aabb();
+		Transform xform = transform * s.xform;
+		shape_aabb = xform.xform(shape_aabb);
+
+		real_t rotation_sweep = 0;
+		if (p_angle != 0) {
+			// no point moves farther than the arc it follows, nor than the diameter of the sphere
+			real_t radius = 0;
+			for (int j = 0; j < 8; j++) {
+				radius = MAX(radius, shape_aabb.get_endpoint(j).distance_to(p_center));
+			}
+			rotation_sweep = MIN(p_angle, (real_t)2.0) * radius;
 		}
 
-		space->get_broadphase()->move(s.bpid, shape_aabb);
+		shape_aabb.merge_with(AABB(shape_aabb.position + p_motion, shape_aabb.size)); //use motion
+		s.aabb_cache = shape_aabb.grow(rotation_sweep);
 	}
 }
 
-void CollisionObject3DSW::_update_shapes_with_motion(const Vector3 &p_motion) {
+void CollisionObject3DSW::_update_broadphase() {
 	if (!space) {
 		return;
 	}
@@ -174,19 +205,12 @@ void CollisionObject3DSW::_update_shapes_with_motion(const Vector3 &p_motion) {
 	for (int i = 0; i < shapes.size(); i++) {
 		Shape &s = shapes.write[i];
 
-		//not quite correct, should compute the next matrix..
-		AABB shape_aabb = s.shape->get_aabb();
-		Transform xform = transform * s.xform;
-		shape_aabb = xform.xform(shape_aabb);
-		shape_aabb.merge_with(AABB(shape_aabb.position + p_motion, shape_aabb.size)); //use motion
-		s.aabb_cache = shape_aabb;
-
 		if (s.bpid == 0) {
-			s.bpid = space->get_broadphase()->create(this, i, shape_aabb, _static);
+			s.bpid = space->get_broadphase()->create(this, i, s.aabb_cache, _static);
 			space->get_broadphase()->set_static(s.bpid, _static);
 		}
 
-		space->get_broadphase()->move(s.bpid, shape_aabb);
+		space->get_broadphase()->move(s.bpid, s.aabb_cache);
 	}
 }
 
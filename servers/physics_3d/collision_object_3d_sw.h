@@ -83,6 +83,12 @@ private:
 
 protected:
 	void _update_shapes_with_motion(const Vector3 &p_motion);
+	// Split versions of the above, for use from worker threads.
+	// Only the shape AABBs are computed, the broadphase is updated later with _update_broadphase().
+	void _update_shape_aabbs();
+	// A rotation also extends the AABBs by how far it can move their points around p_center.
+	void _update_shape_aabbs_with_motion(const Vector3 &p_motion, real_t p_angle = 0, const Vector3 &p_center = Vector3());
+	void _update_broadphase();
 	void _unregister_shapes();
 
 	_FORCE_INLINE_ void _set_transform(const Transform &p_transform, bool p_update_shapes = true) {
@@ -72,11 +72,12 @@ struct _CollectorCallback {
 	Vector3 normal;
 	Vector3 *prev_axis;
 
-	_FORCE_INLINE_ void call(const Vector3 &p_point_A, const Vector3 &p_point_B) {
+	// p_feature identifies the features the contact was generated from, so it can be matched across frames. 0 if unknown.
+	_FORCE_INLINE_ void call(const Vector3 &p_point_A, const Vector3 &p_point_B, int p_feature = 0) {
 		if (swap) {
-			callback(p_point_B, 0, p_point_A, 0, userdata);
+			callback(p_point_B, p_feature, p_point_A, p_feature, userdata);
 		} else {
-			callback(p_point_A, 0, p_point_B, 0, userdata);
+			callback(p_point_A, p_feature, p_point_B, p_feature, userdata);
 		}
 	}
 };
@@ -282,9 +283,27 @@ static void _generate_contacts_face_face(const Vector3 *p_points_A, int p_point_
 	Vector3 *clipbuf_dst = _clipbuf2;
 	int clipbuf_len = p_point_count_A;
 
+	// Feature ids of the clipped points, to match contacts across frames.
+	// Edges of A are numbered from 1 and edges of B from max_clip + 1, below 0x8000 so combined ids stay positive ints.
+	// A vertices keep the id of their outgoing edge, clipped points combine the ids of the two edges they lie on.
+	ERR_FAIL_COND(p_point_count_A > max_clip || p_point_count_B >= 0x8000 - max_clip);
+
+	uint32_t _clipids1[max_clip];
+	uint32_t _clipids2[max_clip];
+	uint32_t *clipids_src = _clipids1;
+	uint32_t *clipids_dst = _clipids2;
+
+	// Id of the edge going from each clipped point to the next one.
+	uint32_t _edgeids1[max_clip];
+	uint32_t _edgeids2[max_clip];
+	uint32_t *edgeids_src = _edgeids1;
+	uint32_t *edgeids_dst = _edgeids2;
+
 	// copy A points to clipbuf_src
 	for (int i = 0; i < p_point_count_A; i++) {
 		clipbuf_src[i] = p_points_A[i];
+		clipids_src[i] = i + 1;
+		edgeids_src[i] = i + 1;
 	}
 
 	Plane plane_B(p_points_B[0], p_points_B[1], p_points_B[2]);
@@ -315,6 +334,8 @@ static void _generate_contacts_face_face(const Vector3 *p_points_A, int p_point_
 			if (dist0 <= 0) { // behind plane
 
 				ERR_FAIL_COND(dst_idx >= max_clip);
+				clipids_dst[dst_idx] = clipids_src[j];
+				edgeids_dst[dst_idx] = edgeids_src[j];
 				clipbuf_dst[dst_idx++] = clipbuf_src[j];
 			}
 
@@ -328,6 +349,10 @@ static void _generate_contacts_face_face(const Vector3 *p_points_A, int p_point_
 				Vector3 inters = edge0_A + rel * dist;
 
 				ERR_FAIL_COND(dst_idx >= max_clip);
+				uint32_t clip_edge_id = max_clip + i + 1;
+				clipids_dst[dst_idx] = (edgeids_src[j] << 16) | clip_edge_id;
+				// Leaving the clip plane, the next point is on the clip edge. Entering it, still on the same edge.
+				edgeids_dst[dst_idx] = dist0 <= 0 ? clip_edge_id : edgeids_src[j];
 				clipbuf_dst[dst_idx] = inters;
 				dst_idx++;
 			}
@@ -335,6 +360,8 @@ static void _generate_contacts_face_face(const Vector3 *p_points_A, int p_point_
 
 		clipbuf_len = dst_idx;
 		SWAP(clipbuf_src, clipbuf_dst);
+		SWAP(clipids_src, clipids_dst);
+		SWAP(edgeids_src, edgeids_dst);
 	}
 
 	// generate contacts
@@ -353,7 +380,7 @@ static void _generate_contacts_face_face(const Vector3 *p_points_A, int p_point_
 			continue;
 		}
 
-		p_callback->call(clipbuf_src[i], closest_B);
+		p_callback->call(clipbuf_src[i], closest_B, clipids_src[i]);
 	}
 }
 
@@ -35,30 +35,74 @@ class Body3DSW;
 class SoftBody3DSW;
 
 class Constraint3DSW {
+public:
+	// Identifies a constraint independently of memory addresses, to order constraints in deterministic mode and match them in snapshots.
+	struct Key {
+		uint64_t first = 0;
+		uint64_t second = 0;
+		uint64_t third = 0;
+
+		_FORCE_INLINE_ bool operator<(const Key &p_key) const {
+			if (first != p_key.first) {
+				return first < p_key.first;
+			}
+			if (second != p_key.second) {
+				return second < p_key.second;
+			}
+			return third < p_key.third;
+		}
+	};
+
+	struct KeyComparator {
+		_FORCE_INLINE_ bool operator()(const Constraint3DSW *p_a, const Constraint3DSW *p_b) const { return p_a->key < p_b->key; }
+	};
+
+private:
 	Body3DSW **_body_ptr;
 	int _body_count;
 	uint64_t island_step;
+	uint64_t setup_step;
+	bool setup_result;
 	int priority;
 	bool disabled_collisions_between_bodies;
 
 	RID self;
+	Key key;
 
 protected:
 	Constraint3DSW(Body3DSW **p_body_ptr = nullptr, int p_body_count = 0) {
 		_body_ptr = p_body_ptr;
 		_body_count = p_body_count;
 		island_step = 0;
+		setup_step = 0;
+		setup_result = false;
 		priority = 1;
 		disabled_collisions_between_bodies = true;
 	}
 
 public:
-	_FORCE_INLINE_ void set_self(const RID &p_self) { self = p_self; }
+	_FORCE_INLINE_ void set_self(const RID &p_self) {
+		self = p_self;
+		key.first = p_self.get_id();
+	}
 	_FORCE_INLINE_ RID get_self() const { return self; }
 
+	_FORCE_INLINE_ void set_key(uint64_t p_first, uint64_t p_second, uint64_t p_third) {
+		key.first = p_first;
+		key.second = p_second;
+		key.third = p_third;
+	}
+	_FORCE_INLINE_ const Key &get_key() const { return key; }
+
 	_FORCE_INLINE_ uint64_t get_island_step() const { return island_step; }
 	_FORCE_INLINE_ void set_island_step(uint64_t p_step) { island_step = p_step; }
 
+	_FORCE_INLINE_ uint64_t get_setup_step() const { return setup_step; }
+	_FORCE_INLINE_ void set_setup_step(uint64_t p_step) { setup_step = p_step; }
+
+	_FORCE_INLINE_ bool get_setup_result() const { return setup_result; }
+	_FORCE_INLINE_ void set_setup_result(bool p_result) { setup_result = p_result; }
+
 	_FORCE_INLINE_ Body3DSW **get_body_ptr() const { return _body_ptr; }
 	_FORCE_INLINE_ int get_body_count() const { return _body_count; }
 
@@ -75,6 +119,16 @@ public:
 	virtual bool pre_solve(real_t p_step) = 0;
 	virtual void solve(real_t p_step) = 0;
 
+	// Fraction of its motion a body can do this step before hitting, found by setup().
+	// setup() runs on worker threads, so the step applies it to the body afterwards.
+	virtual real_t get_time_of_impact(const Body3DSW *p_body) const { return 1.0; }
+
+	// State kept between steps (like accumulated impulses), saved in space snapshots.
+	// load_state() is called with no data for constraints that weren't part of the snapshot.
+	virtual int get_state_size() const { return 0; }
+	virtual void save_state(uint8_t *r_state) const {}
+	virtual void load_state(const uint8_t *p_state, int p_size) {}
+
 	virtual ~Constraint3DSW() {}
 };
 
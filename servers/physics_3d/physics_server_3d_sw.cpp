@@ -186,6 +186,39 @@ real_t PhysicsServer3DSW::space_get_param(RID p_space, SpaceParameter p_param) c
 	return space->get_param(p_param);
 }
 
+void PhysicsServer3DSW::space_set_deterministic(RID p_space, bool p_deterministic) {
+	Space3DSW *space = space_owner.getornull(p_space);
+	ERR_FAIL_COND(!space);
+
+	space->set_deterministic(p_deterministic);
+}
+
+bool PhysicsServer3DSW::space_is_deterministic(RID p_space) const {
+	const Space3DSW *space = space_owner.getornull(p_space);
+	ERR_FAIL_COND_V(!space, false);
+
+	return space->is_deterministic();
+}
+
+Vector<uint8_t> PhysicsServer3DSW::space_save_snapshot(RID p_space) {
+	Space3DSW *space = space_owner.getornull(p_space);
+	ERR_FAIL_COND_V(!space, Vector<uint8_t>());
+	ERR_FAIL_COND_V_MSG(space->is_locked(), Vector<uint8_t>(), "Space snapshots can't be saved while the space is being stepped.");
+
+	return space->save_snapshot();
+}
+
+Error PhysicsServer3DSW::space_restore_snapshot(RID p_space, const Vector<uint8_t> &p_snapshot) {
+	Space3DSW *space = space_owner.getornull(p_space);
+	ERR_FAIL_COND_V(!space, ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V_MSG(space->is_locked(), ERR_LOCKED, "Space snapshots can't be restored while the space is being stepped.");
+
+	// Shapes must be up to date before the restored bodies are paired.
+	_update_shapes();
+
+	return space->restore_snapshot(p_snapshot);
+}
+
 PhysicsDirectSpaceState3D *PhysicsServer3DSW::space_get_direct_state(RID p_space) {
 	Space3DSW *space = space_owner.getornull(p_space);
 	ERR_FAIL_COND_V(!space, nullptr);
@@ -1620,11 +1653,17 @@ void PhysicsServer3DSW::step(real_t p_step) {
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
+	for (int i = 0; i < Space3DSW::ELAPSED_TIME_MAX; i++) {
+		elapsed_time[i] = 0;
+	}
 	for (Set<const Space3DSW *>::Element *E = active_spaces.front(); E; E = E->next()) {
 		stepper->step((Space3DSW *)E->get(), p_step, iterations);
 		island_count += E->get()->get_island_count();
 		active_objects += E->get()->get_active_objects();
 		collision_pairs += E->get()->get_collision_pairs();
+		for (int i = 0; i < Space3DSW::ELAPSED_TIME_MAX; i++) {
+			elapsed_time[i] += E->get()->get_elapsed_time(Space3DSW::ElapsedTime(i));
+		}
 	}
 #endif
 }
@@ -1652,7 +1691,6 @@ void PhysicsServer3DSW::flush_queries() {
 	flushing_queries = false;
 
 	if (EngineDebugger::is_profiling("servers")) {
-		uint64_t total_time[Space3DSW::ELAPSED_TIME_MAX];
 		static const char *time_name[Space3DSW::ELAPSED_TIME_MAX] = {
 			"integrate_forces",
 			"generate_islands",
@@ -1661,21 +1699,11 @@ void PhysicsServer3DSW::flush_queries() {
 			"integrate_velocities"
 		};
 
-		for (int i = 0; i < Space3DSW::ELAPSED_TIME_MAX; i++) {
-			total_time[i] = 0;
-		}
-
-		for (Set<const Space3DSW *>::Element *E = active_spaces.front(); E; E = E->next()) {
-			for (int i = 0; i < Space3DSW::ELAPSED_TIME_MAX; i++) {
-				total_time[i] += E->get()->get_elapsed_time(Space3DSW::ElapsedTime(i));
-			}
-		}
-
 		Array values;
 		values.resize(Space3DSW::ELAPSED_TIME_MAX * 2);
 		for (int i = 0; i < Space3DSW::ELAPSED_TIME_MAX; i++) {
 			values[i * 2 + 0] = time_name[i];
-			values[i * 2 + 1] = USEC_TO_SEC(total_time[i]);
+			values[i * 2 + 1] = USEC_TO_SEC(elapsed_time[i]);
 		}
 		values.push_back("flush_queries");
 		values.push_back(USEC_TO_SEC(OS::get_singleton()->get_ticks_usec() - time_beg));
@@ -1706,6 +1734,21 @@ int PhysicsServer3DSW::get_process_info(ProcessInfo p_info) {
 		case INFO_ISLAND_COUNT: {
 			return island_count;
 		} break;
+		case INFO_INTEGRATE_FORCES_TIME: {
+			return elapsed_time[Space3DSW::ELAPSED_TIME_INTEGRATE_FORCES];
+		} break;
+		case INFO_GENERATE_ISLANDS_TIME: {
+			return elapsed_time[Space3DSW::ELAPSED_TIME_GENERATE_ISLANDS];
+		} break;
+		case INFO_SETUP_CONSTRAINTS_TIME: {
+			return elapsed_time[Space3DSW::ELAPSED_TIME_SETUP_CONSTRAINTS];
+		} break;
+		case INFO_SOLVE_CONSTRAINTS_TIME: {
+			return elapsed_time[Space3DSW::ELAPSED_TIME_SOLVE_CONSTRAINTS];
+		} break;
+		case INFO_INTEGRATE_VELOCITIES_TIME: {
+			return elapsed_time[Space3DSW::ELAPSED_TIME_INTEGRATE_VELOCITIES];
+		} break;
 	}
 
 	return 0;
@@ -1759,6 +1802,9 @@ PhysicsServer3DSW::PhysicsServer3DSW(bool p_using_threads) {
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
+	for (int i = 0; i < Space3DSW::ELAPSED_TIME_MAX; i++) {
+		elapsed_time[i] = 0;
+	}
 	using_threads = p_using_threads;
 	active = true;
 	flushing_queries = false;
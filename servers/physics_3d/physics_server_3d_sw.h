@@ -49,6 +49,7 @@ class PhysicsServer3DSW : public PhysicsServer3D {
 	int island_count;
 	int active_objects;
 	int collision_pairs;
+	uint64_t elapsed_time[Space3DSW::ELAPSED_TIME_MAX];
 
 	bool using_threads;
 	bool doing_sync;
@@ -113,6 +114,12 @@ public:
 	virtual void space_set_param(RID p_space, SpaceParameter p_param, real_t p_value) override;
 	virtual real_t space_get_param(RID p_space, SpaceParameter p_param) const override;
 
+	virtual void space_set_deterministic(RID p_space, bool p_deterministic) override;
+	virtual bool space_is_deterministic(RID p_space) const override;
+
+	virtual Vector<uint8_t> space_save_snapshot(RID p_space) override;
+	virtual Error space_restore_snapshot(RID p_space, const Vector<uint8_t> &p_snapshot) override;
+
 	// this function only works on physics process, errors and returns null otherwise
 	virtual PhysicsDirectSpaceState3D *space_get_direct_state(RID p_space) override;
 
@@ -1647,9 +1647,104 @@ int HeightMapShape3DSW::get_depth() const {
 	return depth;
 }
 
+struct _HeightmapProjectParams {
+	Vector3 normal; // In the heightmap space.
+	const HeightMapShape3DSW *heightmap = nullptr;
+
+	real_t max = -1e20;
+};
+
+// Support of the box of a block along the normal.
+_FORCE_INLINE_ real_t _heightmap_project_block_max(const _HeightmapProjectParams &p_params, int p_level, int p_x, int p_z) {
+	const HeightMapShape3DSW *heightmap = p_params.heightmap;
+
+	int block_size = HeightMapShape3DSW::BOUNDS_CHUNK_SIZE << p_level;
+	int start_x = p_x * block_size;
+	int start_z = p_z * block_size;
+	int end_x = MIN(start_x + block_size, heightmap->width - 1);
+	int end_z = MIN(start_z + block_size, heightmap->depth - 1);
+
+	const HeightMapShape3DSW::Range &bounds = heightmap->_get_bounds(p_level, p_x, p_z);
+
+	Vector3 half_size = Vector3(end_x - start_x, bounds.max - bounds.min, end_z - start_z) * 0.5;
+	Vector3 center = Vector3(start_x, bounds.min, start_z) + half_size - heightmap->local_origin;
+
+	return p_params.normal.dot(center) + Math::abs(p_params.normal.x * half_size.x) + Math::abs(p_params.normal.y * half_size.y) + Math::abs(p_params.normal.z * half_size.z);
+}
+
+static void _heightmap_project_block(_HeightmapProjectParams &p_params, int p_level, int p_x, int p_z, real_t p_block_max) {
+	if (p_block_max <= p_params.max) {
+		return; // Can't extend the range found so far.
+	}
+
+	if (p_level == 0) {
+		p_params.max = p_block_max;
+		return;
+	}
+
+	// Go down the children that reach the furthest first, so the other ones are mostly skipped.
+	const HeightMapShape3DSW::BoundsLevel &child_level = p_params.heightmap->bounds_levels[p_level - 1];
+	int child_end_x = MIN(p_x * 2 + 2, child_level.width);
+	int child_end_z = MIN(p_z * 2 + 2, child_level.depth);
+
+	int child_count = 0;
+	int children_x[4];
+	int children_z[4];
+	real_t children_max[4];
+	for (int z = p_z * 2; z < child_end_z; z++) {
+		for (int x = p_x * 2; x < child_end_x; x++) {
+			real_t child_max = _heightmap_project_block_max(p_params, p_level - 1, x, z);
+
+			int i = child_count++;
+			while (i > 0 && children_max[i - 1] < child_max) {
+				children_x[i] = children_x[i - 1];
+				children_z[i] = children_z[i - 1];
+				children_max[i] = children_max[i - 1];
+				i--;
+			}
+			children_x[i] = x;
+			children_z[i] = z;
+			children_max[i] = child_max;
+		}
+	}
+
+	for (int i = 0; i < child_count; i++) {
+		_heightmap_project_block(p_params, p_level - 1, children_x[i], children_z[i], children_max[i]);
+	}
+}
+
 void HeightMapShape3DSW::project_range(const Vector3 &p_normal, const Transform &p_transform, real_t &r_min, real_t &r_max) const {
-	//not very useful, but not very used either
-	p_transform.xform(get_aabb()).project_range_in_plane(Plane(p_normal, 0), r_min, r_max);
+	if (bounds_levels.is_empty()) {
+		p_transform.xform(get_aabb()).project_range_in_plane(Plane(p_normal, 0), r_min, r_max);
+		return;
+	}
+
+	// Find the furthest blocks of the bounds quadtree in both directions.
+	Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
+	real_t offset = p_normal.dot(p_transform.origin);
+
+	int top = bounds_levels.size() - 1;
+	const BoundsLevel &top_level = bounds_levels[top];
+
+	_HeightmapProjectParams params;
+	params.heightmap = this;
+
+	params.normal = local_normal;
+	for (int z = 0; z < top_level.depth; z++) {
+		for (int x = 0; x < top_level.width; x++) {
+			_heightmap_project_block(params, top, x, z, _heightmap_project_block_max(params, top, x, z));
+		}
+	}
+	r_max = params.max + offset;
+
+	params.normal = -local_normal;
+	params.max = -1e20;
+	for (int z = 0; z < top_level.depth; z++) {
+		for (int x = 0; x < top_level.width; x++) {
+			_heightmap_project_block(params, top, x, z, _heightmap_project_block_max(params, top, x, z));
+		}
+	}
+	r_min = offset - params.max;
 }
 
 Vector3 HeightMapShape3DSW::get_support(const Vector3 &p_normal) const {
@@ -1662,9 +1757,18 @@ struct _HeightmapSegmentCullParams {
 	Vector3 to;
 	Vector3 dir;
 
+	// Segment in grid coordinates, where cell (x, z) spans from x to x + 1 and from z to z + 1.
+	Vector3 local_from;
+	Vector3 local_motion;
+
 	Vector3 result;
 	Vector3 normal;
 
+	bool hit = false;
+	real_t closest_param = 1e20;
+	Vector3 closest_result;
+	Vector3 closest_normal;
+
 	const HeightMapShape3DSW *heightmap = nullptr;
 	FaceShape3DSW *face = nullptr;
 };
@@ -1702,153 +1806,197 @@ _FORCE_INLINE_ bool _heightmap_cell_cull_segment(_HeightmapSegmentCullParams &p_
 	return false;
 }
 
-bool HeightMapShape3DSW::intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal) const {
-	if (heights.is_empty()) {
-		return false;
-	}
-
-	Vector3 local_begin = p_begin + local_origin;
-	Vector3 local_end = p_end + local_origin;
+// Clips the segment to a rectangle of the grid, returns the segment params where it enters and exits it.
+_FORCE_INLINE_ bool _heightmap_clip_segment(const _HeightmapSegmentCullParams &p_params, real_t p_min_x, real_t p_max_x, real_t p_min_z, real_t p_max_z, real_t &r_enter, real_t &r_exit) {
+	real_t enter = 0.0;
+	real_t exit = 1.0;
 
-	FaceShape3DSW face;
-	face.backface_collision = false;
+	const real_t mins[2] = { p_min_x, p_min_z };
+	const real_t maxs[2] = { p_max_x, p_max_z };
+	for (int i = 0; i < 2; i++) {
+		int axis = i * 2; // x or z.
+		real_t begin = p_params.local_from[axis];
+		real_t motion = p_params.local_motion[axis];
 
-	_HeightmapSegmentCullParams params;
-	params.from = p_begin;
-	params.to = p_end;
-	params.dir = (p_end - p_begin).normalized();
-	params.heightmap = this;
-	params.face = &face;
+		if (Math::abs(motion) < CMP_EPSILON) {
+			if (begin < mins[i] || begin > maxs[i]) {
+				return false;
+			}
+			continue;
+		}
 
-	// Quantize the ray begin/end.
-	int begin_x = floor(local_begin.x);
-	int begin_z = floor(local_begin.z);
-	int end_x = floor(local_end.x);
-	int end_z = floor(local_end.z);
-
-	if ((begin_x == end_x) && (begin_z == end_z)) {
-		// Simple case for rays that don't traverse the grid horizontally.
-		// Just perform a test on the given cell.
-		int x = CLAMP(begin_x, 0, width - 2);
-		int z = CLAMP(begin_z, 0, depth - 2);
-		if (_heightmap_cell_cull_segment(params, x, z)) {
-			r_point = params.result;
-			r_normal = params.normal;
-			return true;
+		real_t param_min = (mins[i] - begin) / motion;
+		real_t param_max = (maxs[i] - begin) / motion;
+		if (param_min > param_max) {
+			SWAP(param_min, param_max);
 		}
-	} else {
-		// Perform grid query from projected ray.
-		Vector2 ray_dir_proj(local_end.x - local_begin.x, local_end.z - local_begin.z);
-		real_t ray_dist_proj = ray_dir_proj.length();
 
-		if (ray_dist_proj < CMP_EPSILON) {
-			ray_dir_proj = Vector2();
-		} else {
-			ray_dir_proj /= ray_dist_proj;
+		enter = MAX(enter, param_min);
+		exit = MIN(exit, param_max);
+		if (enter > exit) {
+			return false;
 		}
+	}
 
-		const int x_step = (ray_dir_proj.x > CMP_EPSILON) ? 1 : ((ray_dir_proj.x < -CMP_EPSILON) ? -1 : 0);
-		const int z_step = (ray_dir_proj.y > CMP_EPSILON) ? 1 : ((ray_dir_proj.y < -CMP_EPSILON) ? -1 : 0);
+	r_enter = enter;
+	r_exit = exit;
+	return true;
+}
 
-		const real_t infinite = 1e20;
-		const real_t delta_x = (x_step != 0) ? 1.f / Math::abs(ray_dir_proj.x) : infinite;
-		const real_t delta_z = (z_step != 0) ? 1.f / Math::abs(ray_dir_proj.y) : infinite;
+// Whether the segment passes within the given heights between the enter and exit params.
+_FORCE_INLINE_ bool _heightmap_segment_overlaps(const _HeightmapSegmentCullParams &p_params, real_t p_enter, real_t p_exit, real_t p_min_height, real_t p_max_height) {
+	real_t enter_height = p_params.local_from.y + p_params.local_motion.y * p_enter;
+	real_t exit_height = p_params.local_from.y + p_params.local_motion.y * p_exit;
+	return MAX(enter_height, exit_height) >= p_min_height - CMP_EPSILON && MIN(enter_height, exit_height) <= p_max_height + CMP_EPSILON;
+}
 
-		real_t cross_x; // At which value of `param` we will cross a x-axis lane?
-		real_t cross_z; // At which value of `param` we will cross a z-axis lane?
+static void _heightmap_segment_cull_block(_HeightmapSegmentCullParams &p_params, int p_level, int p_x, int p_z) {
+	const HeightMapShape3DSW *heightmap = p_params.heightmap;
 
-		// X initialization.
-		if (x_step != 0) {
-			if (x_step == 1) {
-				cross_x = (ceil(local_begin.x) - local_begin.x) * delta_x;
-			} else {
-				cross_x = (local_begin.x - floor(local_begin.x)) * delta_x;
-			}
-		} else {
-			cross_x = infinite; // Will never cross on X.
-		}
+	int block_size = HeightMapShape3DSW::BOUNDS_CHUNK_SIZE << p_level;
+	int start_x = p_x * block_size;
+	int start_z = p_z * block_size;
+	int end_x = MIN(start_x + block_size, heightmap->width - 1);
+	int end_z = MIN(start_z + block_size, heightmap->depth - 1);
 
-		// Z initialization.
-		if (z_step != 0) {
-			if (z_step == 1) {
-				cross_z = (ceil(local_begin.z) - local_begin.z) * delta_z;
-			} else {
-				cross_z = (local_begin.z - floor(local_begin.z)) * delta_z;
-			}
-		} else {
-			cross_z = infinite; // Will never cross on Z.
-		}
+	real_t enter, exit;
+	if (!_heightmap_clip_segment(p_params, start_x, end_x, start_z, end_z, enter, exit)) {
+		return;
+	}
 
-		int x = floor(local_begin.x);
-		int z = floor(local_begin.z);
+	if (enter > p_params.closest_param) {
+		return; // Something closer was already hit.
+	}
 
-		// Workaround cases where the ray starts at an integer position.
-		if (Math::abs(cross_x) < CMP_EPSILON) {
-			cross_x += delta_x;
-			// If going backwards, we should ignore the position we would get by the above flooring,
-			// because the ray is not heading in that direction.
-			if (x_step == -1) {
-				x -= 1;
-			}
-		}
+	const HeightMapShape3DSW::Range &bounds = heightmap->_get_bounds(p_level, p_x, p_z);
+	if (!_heightmap_segment_overlaps(p_params, enter, exit, bounds.min, bounds.max)) {
+		return;
+	}
+
+	if (p_level == 0) {
+		// Test the cells under the part of the segment inside this block.
+		real_t enter_x = p_params.local_from.x + p_params.local_motion.x * enter;
+		real_t exit_x = p_params.local_from.x + p_params.local_motion.x * exit;
+		real_t enter_z = p_params.local_from.z + p_params.local_motion.z * enter;
+		real_t exit_z = p_params.local_from.z + p_params.local_motion.z * exit;
+
+		int cell_start_x = MAX(start_x, (int)Math::floor(MIN(enter_x, exit_x)));
+		int cell_end_x = MIN(end_x - 1, (int)Math::floor(MAX(enter_x, exit_x)));
+		int cell_start_z = MAX(start_z, (int)Math::floor(MIN(enter_z, exit_z)));
+		int cell_end_z = MIN(end_z - 1, (int)Math::floor(MAX(enter_z, exit_z)));
+
+		for (int z = cell_start_z; z <= cell_end_z; z++) {
+			for (int x = cell_start_x; x <= cell_end_x; x++) {
+				real_t cell_enter, cell_exit;
+				if (!_heightmap_clip_segment(p_params, x, x + 1, z, z + 1, cell_enter, cell_exit)) {
+					continue;
+				}
+
+				if (cell_enter > p_params.closest_param) {
+					continue;
+				}
 
-		if (Math::abs(cross_z) < CMP_EPSILON) {
-			cross_z += delta_z;
-			if (z_step == -1) {
-				z -= 1;
+				real_t height_0 = heightmap->_get_height(x, z);
+				real_t height_1 = heightmap->_get_height(x + 1, z);
+				real_t height_2 = heightmap->_get_height(x, z + 1);
+				real_t height_3 = heightmap->_get_height(x + 1, z + 1);
+				real_t min_height = MIN(MIN(height_0, height_1), MIN(height_2, height_3));
+				real_t max_height = MAX(MAX(height_0, height_1), MAX(height_2, height_3));
+				if (!_heightmap_segment_overlaps(p_params, cell_enter, cell_exit, min_height, max_height)) {
+					continue;
+				}
+
+				if (_heightmap_cell_cull_segment(p_params, x, z)) {
+					Vector3 motion = p_params.to - p_params.from;
+					real_t param = (p_params.result - p_params.from).dot(motion) / motion.length_squared();
+					if (param < p_params.closest_param) {
+						p_params.hit = true;
+						p_params.closest_param = param;
+						p_params.closest_result = p_params.result;
+						p_params.closest_normal = p_params.normal;
+					}
+				}
 			}
 		}
 
-		// Start inside the grid.
-		int x_start = CLAMP(x, 0, width - 2);
-		int z_start = CLAMP(z, 0, depth - 2);
+		return;
+	}
 
-		// Adjust initial cross values.
-		cross_x += delta_x * x_step * (x_start - x);
-		cross_z += delta_z * z_step * (z_start - z);
+	// Visit the children closest to the segment begin first, so the farther ones can be skipped after a hit.
+	const HeightMapShape3DSW::BoundsLevel &child_level = heightmap->bounds_levels[p_level - 1];
 
-		x = x_start;
-		z = z_start;
+	int children_x[2] = { p_x * 2, p_x * 2 + 1 };
+	int children_z[2] = { p_z * 2, p_z * 2 + 1 };
+	if (p_params.local_motion.x < 0.0) {
+		SWAP(children_x[0], children_x[1]);
+	}
+	if (p_params.local_motion.z < 0.0) {
+		SWAP(children_z[0], children_z[1]);
+	}
 
-		if (_heightmap_cell_cull_segment(params, x, z)) {
-			r_point = params.result;
-			r_normal = params.normal;
-			return true;
+	for (int i = 0; i < 2; i++) {
+		if (children_z[i] >= child_level.depth) {
+			continue;
 		}
-
-		real_t dist = 0.0;
-		while (true) {
-			if (cross_x < cross_z) {
-				// X lane.
-				x += x_step;
-				// Assign before advancing the param,
-				// to be in sync with the initialization step.
-				dist = cross_x;
-				cross_x += delta_x;
-			} else {
-				// Z lane.
-				z += z_step;
-				dist = cross_z;
-				cross_z += delta_z;
+		for (int j = 0; j < 2; j++) {
+			if (children_x[j] >= child_level.width) {
+				continue;
 			}
+			_heightmap_segment_cull_block(p_params, p_level - 1, children_x[j], children_z[i]);
+		}
+	}
+}
 
-			// Stop when outside the grid.
-			if ((x < 0) || (z < 0) || (x >= width - 1) || (z >= depth - 1)) {
-				break;
-			}
+bool HeightMapShape3DSW::intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal) const {
+	if (bounds_levels.is_empty()) {
+		return false;
+	}
 
-			if (_heightmap_cell_cull_segment(params, x, z)) {
-				r_point = params.result;
-				r_normal = params.normal;
-				return true;
-			}
+	FaceShape3DSW face;
+	face.backface_collision = false;
 
-			if (dist > ray_dist_proj) {
-				break;
+	_HeightmapSegmentCullParams params;
+	params.from = p_begin;
+	params.to = p_end;
+	params.dir = (p_end - p_begin).normalized();
+	params.local_from = p_begin + local_origin;
+	params.local_motion = p_end - p_begin;
+	params.heightmap = this;
+	params.face = &face;
+
+	// Start from the smallest block containing the part of the segment over the heightmap,
+	// then go down the bounds quadtree, skipping the blocks the segment passes above or below.
+	Vector3 local_end = params.local_from + params.local_motion;
+	int min_x = CLAMP((int)Math::floor(MIN(params.local_from.x, local_end.x)), 0, width - 2);
+	int max_x = CLAMP((int)Math::floor(MAX(params.local_from.x, local_end.x)), 0, width - 2);
+	int min_z = CLAMP((int)Math::floor(MIN(params.local_from.z, local_end.z)), 0, depth - 2);
+	int max_z = CLAMP((int)Math::floor(MAX(params.local_from.z, local_end.z)), 0, depth - 2);
+
+	int top = bounds_levels.size() - 1;
+	int level = 0;
+	int block_size = BOUNDS_CHUNK_SIZE;
+	while (level < top && ((min_x / block_size) != (max_x / block_size) || (min_z / block_size) != (max_z / block_size))) {
+		level++;
+		block_size <<= 1;
+	}
+
+	if (level < top) {
+		_heightmap_segment_cull_block(params, level, min_x / block_size, min_z / block_size);
+	} else {
+		const BoundsLevel &top_level = bounds_levels[top];
+		for (int z = 0; z < top_level.depth; z++) {
+			for (int x = 0; x < top_level.width; x++) {
+				_heightmap_segment_cull_block(params, top, x, z);
 			}
 		}
 	}
 
+	if (params.hit) {
+		r_point = params.closest_result;
+		r_normal = params.closest_normal;
+		return true;
+	}
+
 	return false;
 }
 
@@ -1875,8 +2023,80 @@ void HeightMapShape3DSW::_get_cell(const Vector3 &p_point, int &r_x, int &r_y, i
 	r_z = (clamped_point.z < 0.0) ? (clamped_point.z - 0.5) : (clamped_point.z + 0.5);
 }
 
+struct _HeightmapCullParams {
+	int start_x = 0;
+	int end_x = 0;
+	int start_z = 0;
+	int end_z = 0;
+	real_t min_height = 0.0;
+	real_t max_height = 0.0;
+
+	const HeightMapShape3DSW *heightmap = nullptr;
+	FaceShape3DSW *face = nullptr;
+	ConcaveShape3DSW::Callback callback = nullptr;
+	void *userdata = nullptr;
+};
+
+static void _heightmap_cull_block(_HeightmapCullParams &p_params, int p_level, int p_x, int p_z) {
+	const HeightMapShape3DSW *heightmap = p_params.heightmap;
+
+	const HeightMapShape3DSW::Range &bounds = heightmap->_get_bounds(p_level, p_x, p_z);
+	if (bounds.min > p_params.max_height || bounds.max < p_params.min_height) {
+		return;
+	}
+
+	int block_size = HeightMapShape3DSW::BOUNDS_CHUNK_SIZE << p_level;
+	int start_x = MAX(p_x * block_size, p_params.start_x);
+	int start_z = MAX(p_z * block_size, p_params.start_z);
+	int end_x = MIN((p_x + 1) * block_size, p_params.end_x);
+	int end_z = MIN((p_z + 1) * block_size, p_params.end_z);
+
+	if (start_x >= end_x || start_z >= end_z) {
+		return;
+	}
+
+	if (p_level > 0) {
+		const HeightMapShape3DSW::BoundsLevel &child_level = heightmap->bounds_levels[p_level - 1];
+		int child_end_x = MIN(p_x * 2 + 2, child_level.width);
+		int child_end_z = MIN(p_z * 2 + 2, child_level.depth);
+		for (int z = p_z * 2; z < child_end_z; z++) {
+			for (int x = p_x * 2; x < child_end_x; x++) {
+				_heightmap_cull_block(p_params, p_level - 1, x, z);
+			}
+		}
+		return;
+	}
+
+	FaceShape3DSW &face = *p_params.face;
+
+	for (int z = start_z; z < end_z; z++) {
+		for (int x = start_x; x < end_x; x++) {
+			real_t height_0 = heightmap->_get_height(x, z);
+			real_t height_1 = heightmap->_get_height(x + 1, z);
+			real_t height_2 = heightmap->_get_height(x, z + 1);
+			real_t height_3 = heightmap->_get_height(x + 1, z + 1);
+			if (MIN(MIN(height_0, height_1), MIN(height_2, height_3)) > p_params.max_height || MAX(MAX(height_0, height_1), MAX(height_2, height_3)) < p_params.min_height) {
+				continue;
+			}
+
+			// First triangle.
+			heightmap->_get_point(x, z, face.vertex[0]);
+			heightmap->_get_point(x + 1, z, face.vertex[1]);
+			heightmap->_get_point(x, z + 1, face.vertex[2]);
+			face.normal = Plane(face.vertex[0], face.vertex[2], face.vertex[1]).normal;
+			p_params.callback(p_params.userdata, &face);
+
+			// Second triangle.
+			face.vertex[0] = face.vertex[1];
+			heightmap->_get_point(x + 1, z + 1, face.vertex[1]);
+			face.normal = Plane(face.vertex[0], face.vertex[2], face.vertex[1]).normal;
+			p_params.callback(p_params.userdata, &face);
+		}
+	}
+}
+
 void HeightMapShape3DSW::cull(const AABB &p_local_aabb, Callback p_callback, void *p_userdata) const {
-	if (heights.is_empty()) {
+	if (bounds_levels.is_empty()) {
 		return;
 	}
 
@@ -1896,28 +2116,27 @@ void HeightMapShape3DSW::cull(const AABB &p_local_aabb, Callback p_callback, voi
 		aabb_max[i]++;
 	}
 
-	int start_x = MAX(0, aabb_min[0]);
-	int end_x = MIN(width - 1, aabb_max[0]);
-	int start_z = MAX(0, aabb_min[2]);
-	int end_z = MIN(depth - 1, aabb_max[2]);
-
 	FaceShape3DSW face;
 	face.backface_collision = true;
 
-	for (int z = start_z; z < end_z; z++) {
-		for (int x = start_x; x < end_x; x++) {
-			// First triangle.
-			_get_point(x, z, face.vertex[0]);
-			_get_point(x + 1, z, face.vertex[1]);
-			_get_point(x, z + 1, face.vertex[2]);
-			face.normal = Plane(face.vertex[0], face.vertex[2], face.vertex[1]).normal;
-			p_callback(p_userdata, &face);
+	_HeightmapCullParams params;
+	params.start_x = MAX(0, aabb_min[0]);
+	params.end_x = MIN(width - 1, aabb_max[0]);
+	params.start_z = MAX(0, aabb_min[2]);
+	params.end_z = MIN(depth - 1, aabb_max[2]);
+	params.min_height = local_aabb.position.y;
+	params.max_height = local_aabb.position.y + local_aabb.size.y;
+	params.heightmap = this;
+	params.face = &face;
+	params.callback = p_callback;
+	params.userdata = p_userdata;
 
-			// Second triangle.
-			face.vertex[0] = face.vertex[1];
-			_get_point(x + 1, z + 1, face.vertex[1]);
-			face.normal = Plane(face.vertex[0], face.vertex[2], face.vertex[1]).normal;
-			p_callback(p_userdata, &face);
+	// Go down the bounds quadtree, skipping the blocks outside the aabb.
+	int top = bounds_levels.size() - 1;
+	const BoundsLevel &top_level = bounds_levels[top];
+	for (int z = 0; z < top_level.depth; z++) {
+		for (int x = 0; x < top_level.width; x++) {
+			_heightmap_cull_block(params, top, x, z);
 		}
 	}
 }
@@ -1932,11 +2151,87 @@ Vector3 HeightMapShape3DSW::get_moment_of_inertia(real_t p_mass) const {
 			(p_mass / 3.0) * (extents.x * extents.x + extents.y * extents.y));
 }
 
+void HeightMapShape3DSW::_build_bounds() {
+	bounds_levels.clear();
+
+	int cells_width = width - 1;
+	int cells_depth = depth - 1;
+	if (cells_width <= 0 || cells_depth <= 0) {
+		return;
+	}
+
+	const float *heights_ptr = heights.ptr();
+
+	// First level, from the heights of the cells in each block.
+	bounds_levels.resize(1);
+	{
+		BoundsLevel &level = bounds_levels[0];
+		level.width = (cells_width + BOUNDS_CHUNK_SIZE - 1) / BOUNDS_CHUNK_SIZE;
+		level.depth = (cells_depth + BOUNDS_CHUNK_SIZE - 1) / BOUNDS_CHUNK_SIZE;
+		level.ranges.resize(level.width * level.depth);
+
+		for (int block_z = 0; block_z < level.depth; block_z++) {
+			int start_z = block_z * BOUNDS_CHUNK_SIZE;
+			int end_z = MIN(start_z + BOUNDS_CHUNK_SIZE, cells_depth);
+
+			for (int block_x = 0; block_x < level.width; block_x++) {
+				int start_x = block_x * BOUNDS_CHUNK_SIZE;
+				int end_x = MIN(start_x + BOUNDS_CHUNK_SIZE, cells_width);
+
+				Range range;
+				range.min = heights_ptr[(start_z * width) + start_x];
+				range.max = range.min;
+
+				for (int z = start_z; z <= end_z; z++) {
+					for (int x = start_x; x <= end_x; x++) {
+						float h = heights_ptr[(z * width) + x];
+						range.min = MIN(range.min, h);
+						range.max = MAX(range.max, h);
+					}
+				}
+
+				level.ranges[(block_z * level.width) + block_x] = range;
+			}
+		}
+	}
+
+	// Next levels merge 2x2 blocks of the previous one.
+	while (bounds_levels[bounds_levels.size() - 1].width > 1 || bounds_levels[bounds_levels.size() - 1].depth > 1) {
+		bounds_levels.resize(bounds_levels.size() + 1);
+
+		const BoundsLevel &previous = bounds_levels[bounds_levels.size() - 2];
+		BoundsLevel &level = bounds_levels[bounds_levels.size() - 1];
+		level.width = (previous.width + 1) / 2;
+		level.depth = (previous.depth + 1) / 2;
+		level.ranges.resize(level.width * level.depth);
+
+		for (int block_z = 0; block_z < level.depth; block_z++) {
+			for (int block_x = 0; block_x < level.width; block_x++) {
+				Range range = previous.ranges[(block_z * 2 * previous.width) + block_x * 2];
+
+				int child_end_x = MIN(block_x * 2 + 2, previous.width);
+				int child_end_z = MIN(block_z * 2 + 2, previous.depth);
+				for (int z = block_z * 2; z < child_end_z; z++) {
+					for (int x = block_x * 2; x < child_end_x; x++) {
+						const Range &child = previous.ranges[(z * previous.width) + x];
+						range.min = MIN(range.min, child.min);
+						range.max = MAX(range.max, child.max);
+					}
+				}
+
+				level.ranges[(block_z * level.width) + block_x] = range;
+			}
+		}
+	}
+}
+
 void HeightMapShape3DSW::_setup(const Vector<float> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height) {
 	heights = p_heights;
 	width = p_width;
 	depth = p_depth;
 
+	_build_bounds();
+
 	// Initialize aabb.
 	AABB aabb;
 	aabb.position = Vector3(0.0, p_min_height, 0.0);
@@ -1996,9 +2291,9 @@ void HeightMapShape3DSW::set_data(const Variant &p_data) {
 		min_height = d["min_height"];
 		max_height = d["max_height"];
 	} else {
-		int heights_size = heights.size();
+		int heights_size = heights_buffer.size();
 		for (int i = 0; i < heights_size; ++i) {
-			float h = heights[i];
+			float h = heights_buffer[i];
 			if (h < min_height) {
 				min_height = h;
 			} else if (h > max_height) {
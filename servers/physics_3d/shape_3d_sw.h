@@ -32,6 +32,7 @@
 #define SHAPE_SW_H
 
 #include "core/math/geometry_3d.h"
+#include "core/templates/local_vector.h"
 #include "servers/physics_server_3d.h"
 /*
 
@@ -389,11 +390,30 @@ public:
 };
 
 struct HeightMapShape3DSW : public ConcaveShape3DSW {
+	enum {
+		BOUNDS_CHUNK_SIZE = 16, // Cells per side of the blocks in the first bounds level.
+	};
+
+	struct Range {
+		float min = 0.0;
+		float max = 0.0;
+	};
+
+	// Min/max quadtree of the heights, stored as levels of blocks of cells.
+	// Each level merges 2x2 blocks of the previous one, up to a single block.
+	struct BoundsLevel {
+		LocalVector<Range> ranges;
+		int width = 0;
+		int depth = 0;
+	};
+
 	Vector<float> heights;
 	int width = 0;
 	int depth = 0;
 	Vector3 local_origin;
 
+	LocalVector<BoundsLevel> bounds_levels;
+
 	_FORCE_INLINE_ float _get_height(int p_x, int p_z) const {
 		return heights[(p_z * width) + p_x];
 	}
@@ -404,8 +424,14 @@ struct HeightMapShape3DSW : public ConcaveShape3DSW {
 		r_point.z = p_z - 0.5 * (depth - 1.0);
 	}
 
+	_FORCE_INLINE_ const Range &_get_bounds(int p_level, int p_x, int p_z) const {
+		const BoundsLevel &level = bounds_levels[p_level];
+		return level.ranges[(p_z * level.width) + p_x];
+	}
+
 	void _get_cell(const Vector3 &p_point, int &r_x, int &r_y, int &r_z) const;
 
+	void _build_bounds();
 	void _setup(const Vector<float> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height);
 
 public:
@@ -34,6 +34,9 @@
 #include "core/config/project_settings.h"
 #include "physics_server_3d_sw.h"
 
+// Smaller batches of rays are intersected on the calling thread.
+#define RAY_BATCH_THREADED_MIN_SIZE 128
+
 _FORCE_INLINE_ static bool _can_collide_with(CollisionObject3DSW *p_object, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
 	if (!(p_object->get_collision_layer() & p_collision_mask)) {
 		return false;
@@ -180,6 +183,120 @@ bool PhysicsDirectSpaceState3DSW::intersect_ray(const Vector3 &p_from, const Vec
 	return true;
 }
 
+void PhysicsDirectSpaceState3DSW::_intersect_batch_ray(uint32_t p_ray_index, void *p_userdata) {
+	const Vector3 &begin = ray_from[p_ray_index];
+	const Vector3 &end = ray_to[p_ray_index];
+	Vector3 normal = (end - begin).normalized();
+
+	RayHit &hit = ray_hits[p_ray_index];
+	hit.object = nullptr;
+	real_t min_d = 1e10;
+
+	uint32_t candidate_end = ray_candidate_offsets[p_ray_index + 1];
+	for (uint32_t candidate_index = ray_candidate_offsets[p_ray_index]; candidate_index < candidate_end; ++candidate_index) {
+		const CollisionObject3DSW *col_obj = ray_candidates[candidate_index].object;
+		int shape_idx = ray_candidates[candidate_index].shape;
+
+		Transform inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
+
+		Vector3 local_from = inv_xform.xform(begin);
+		Vector3 local_to = inv_xform.xform(end);
+
+		const Shape3DSW *shape = col_obj->get_shape(shape_idx);
+
+		Vector3 shape_point, shape_normal;
+
+		if (shape->intersect_segment(local_from, local_to, shape_point, shape_normal)) {
+			Transform xform = col_obj->get_transform() * col_obj->get_shape_transform(shape_idx);
+			shape_point = xform.xform(shape_point);
+
+			real_t ld = normal.dot(shape_point);
+
+			if (ld < min_d) {
+				min_d = ld;
+				hit.position = shape_point;
+				hit.normal = inv_xform.basis.xform_inv(shape_normal).normalized();
+				hit.object = col_obj;
+				hit.shape = shape_idx;
+			}
+		}
+	}
+}
+
+int PhysicsDirectSpaceState3DSW::intersect_rays(const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, const Set<RID> &p_exclude, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
+	ERR_FAIL_COND_V(space->locked, 0);
+	ERR_FAIL_COND_V(p_ray_count < 0, 0);
+
+	// The broadphase can't be culled from several threads at once, gather the candidates of all rays first.
+	ray_candidates.clear();
+	ray_candidate_offsets.resize(p_ray_count + 1);
+	for (int ray_index = 0; ray_index < p_ray_count; ray_index++) {
+		ray_candidate_offsets[ray_index] = ray_candidates.size();
+
+		int amount = space->broadphase->cull_segment(p_from[ray_index], p_to[ray_index], space->intersection_query_results, Space3DSW::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+		for (int i = 0; i < amount; i++) {
+			CollisionObject3DSW *col_obj = space->intersection_query_results[i];
+			if (!_can_collide_with(col_obj, p_collision_mask, p_collide_with_bodies, p_collide_with_areas)) {
+				continue;
+			}
+
+			if (p_exclude.has(col_obj->get_self())) {
+				continue;
+			}
+
+			RayCandidate candidate;
+			candidate.object = col_obj;
+			candidate.shape = space->intersection_query_subindex_results[i];
+			ray_candidates.push_back(candidate);
+		}
+	}
+	ray_candidate_offsets[p_ray_count] = ray_candidates.size();
+
+	ray_from = p_from;
+	ray_to = p_to;
+	ray_hits.resize(p_ray_count);
+
+	if (p_ray_count >= RAY_BATCH_THREADED_MIN_SIZE) {
+		// Queries can't run while stepping, the stepper's threads are idle.
+		PhysicsServer3DSW::singletonsw->stepper->get_work_pool().do_work(p_ray_count, this, &PhysicsDirectSpaceState3DSW::_intersect_batch_ray, nullptr);
+	} else {
+		for (int ray_index = 0; ray_index < p_ray_count; ray_index++) {
+			_intersect_batch_ray(ray_index);
+		}
+	}
+
+	ray_from = nullptr;
+	ray_to = nullptr;
+
+	int hit_count = 0;
+	for (int ray_index = 0; ray_index < p_ray_count; ray_index++) {
+		const RayHit &hit = ray_hits[ray_index];
+		RayResult &result = r_results[ray_index];
+
+		if (!hit.object) {
+			result.rid = RID();
+			result.collider_id = ObjectID();
+			result.collider = nullptr;
+			result.shape = -1;
+			continue;
+		}
+
+		result.collider_id = hit.object->get_instance_id();
+		if (result.collider_id.is_valid()) {
+			result.collider = ObjectDB::get_instance(result.collider_id);
+		} else {
+			result.collider = nullptr;
+		}
+		result.normal = hit.normal;
+		result.position = hit.position;
+		result.rid = hit.object->get_self();
+		result.shape = hit.shape;
+		hit_count++;
+	}
+
+	return hit_count;
+}
+
 int PhysicsDirectSpaceState3DSW::intersect_shape(const RID &p_shape, const Transform &p_xform, real_t p_margin, ShapeResult *r_results, int p_result_max, const Set<RID> &p_exclude, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
 	if (p_result_max <= 0) {
 		return 0;
@@ -1043,7 +1160,8 @@ void *Space3DSW::_broadphase_pair(CollisionObject3DSW *A, int p_subindex_A, Coll
 
 	CollisionObject3DSW::Type type_A = A->get_type();
 	CollisionObject3DSW::Type type_B = B->get_type();
-	if (type_A > type_B) {
+	// Objects of the same type are ordered by RID, so a pair doesn't depend on which object the broadphase found first.
+	if (type_A > type_B || (type_A == type_B && A->get_self().get_id() > B->get_self().get_id())) {
 		SWAP(A, B);
 		SWAP(p_subindex_A, p_subindex_B);
 		SWAP(type_A, type_B);
@@ -1264,6 +1382,164 @@ bool Space3DSW::is_locked() const {
 	return locked;
 }
 
+// Snapshots are plain copies of the simulation state, only meant to be restored by the same build.
+#define SNAPSHOT_MAGIC 0x534E5350 // "PSNS"
+#define SNAPSHOT_VERSION 1
+
+struct _SnapshotHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t real_size;
+	uint32_t dimensions;
+	uint32_t body_count;
+	uint32_t constraint_count;
+};
+
+struct _SnapshotBody {
+	uint64_t id;
+	Body3DSW::State state;
+};
+
+struct _SnapshotConstraint {
+	Constraint3DSW::Key key;
+	uint32_t state_size;
+};
+
+Vector<uint8_t> Space3DSW::save_snapshot() const {
+	ERR_FAIL_COND_V(locked, Vector<uint8_t>());
+
+	LocalVector<Body3DSW *> bodies;
+	for (const Set<CollisionObject3DSW *>::Element *E = objects.front(); E; E = E->next()) {
+		if (E->get()->get_type() == CollisionObject3DSW::TYPE_BODY) {
+			bodies.push_back(static_cast<Body3DSW *>(E->get()));
+		}
+	}
+
+	uint32_t size = sizeof(_SnapshotHeader) + bodies.size() * sizeof(_SnapshotBody);
+
+	LocalVector<Constraint3DSW *> constraints;
+	for (uint32_t body_index = 0; body_index < bodies.size(); ++body_index) {
+		Body3DSW *body = bodies[body_index];
+		const Map<Constraint3DSW *, int> &constraint_map = body->get_constraint_map();
+		for (const Map<Constraint3DSW *, int>::Element *E = constraint_map.front(); E; E = E->next()) {
+			if (E->get() != 0) {
+				continue; // Saved with the first body.
+			}
+			Constraint3DSW *constraint = E->key();
+			int state_size = constraint->get_state_size();
+			if (state_size > 0) {
+				constraints.push_back(constraint);
+				size += sizeof(_SnapshotConstraint) + state_size;
+			}
+		}
+	}
+
+	Vector<uint8_t> snapshot;
+	snapshot.resize(size);
+	uint8_t *w = snapshot.ptrw();
+
+	_SnapshotHeader header;
+	header.magic = SNAPSHOT_MAGIC;
+	header.version = SNAPSHOT_VERSION;
+	header.real_size = sizeof(real_t);
+	header.dimensions = 3;
+	header.body_count = bodies.size();
+	header.constraint_count = constraints.size();
+	memcpy(w, &header, sizeof(_SnapshotHeader));
+	uint32_t offset = sizeof(_SnapshotHeader);
+
+	for (uint32_t body_index = 0; body_index < bodies.size(); ++body_index) {
+		_SnapshotBody record;
+		record.id = bodies[body_index]->get_self().get_id();
+		bodies[body_index]->save_state(record.state);
+		memcpy(w + offset, &record, sizeof(_SnapshotBody));
+		offset += sizeof(_SnapshotBody);
+	}
+
+	for (uint32_t constraint_index = 0; constraint_index < constraints.size(); ++constraint_index) {
+		_SnapshotConstraint record;
+		record.key = constraints[constraint_index]->get_key();
+		record.state_size = constraints[constraint_index]->get_state_size();
+		memcpy(w + offset, &record, sizeof(_SnapshotConstraint));
+		offset += sizeof(_SnapshotConstraint);
+		constraints[constraint_index]->save_state(w + offset);
+		offset += record.state_size;
+	}
+
+	return snapshot;
+}
+
+Error Space3DSW::restore_snapshot(const Vector<uint8_t> &p_snapshot) {
+	ERR_FAIL_COND_V(locked, ERR_LOCKED);
+
+	const uint8_t *r = p_snapshot.ptr();
+	uint32_t size = p_snapshot.size();
+
+	ERR_FAIL_COND_V_MSG(size < sizeof(_SnapshotHeader), ERR_INVALID_DATA, "Invalid physics space snapshot.");
+	_SnapshotHeader header;
+	memcpy(&header, r, sizeof(_SnapshotHeader));
+	ERR_FAIL_COND_V_MSG(header.magic != SNAPSHOT_MAGIC || header.dimensions != 3, ERR_INVALID_DATA, "Invalid physics space snapshot.");
+	ERR_FAIL_COND_V_MSG(header.version != SNAPSHOT_VERSION || header.real_size != sizeof(real_t), ERR_INVALID_DATA, "Physics space snapshot was saved by an incompatible build.");
+
+	uint32_t offset = sizeof(_SnapshotHeader);
+	uint32_t body_offset = offset;
+	ERR_FAIL_COND_V_MSG(header.body_count > (size - offset) / sizeof(_SnapshotBody), ERR_INVALID_DATA, "Truncated physics space snapshot.");
+	offset += header.body_count * sizeof(_SnapshotBody);
+
+	// Check the whole snapshot before changing anything.
+	Map<Constraint3DSW::Key, uint32_t> constraint_offsets;
+	for (uint32_t constraint_index = 0; constraint_index < header.constraint_count; ++constraint_index) {
+		ERR_FAIL_COND_V_MSG(size - offset < sizeof(_SnapshotConstraint), ERR_INVALID_DATA, "Truncated physics space snapshot.");
+		_SnapshotConstraint record;
+		memcpy(&record, r + offset, sizeof(_SnapshotConstraint));
+		ERR_FAIL_COND_V_MSG(size - offset - sizeof(_SnapshotConstraint) < record.state_size, ERR_INVALID_DATA, "Truncated physics space snapshot.");
+		constraint_offsets[record.key] = offset;
+		offset += sizeof(_SnapshotConstraint) + record.state_size;
+	}
+	ERR_FAIL_COND_V_MSG(offset != size, ERR_INVALID_DATA, "Invalid physics space snapshot.");
+
+	HashMap<uint64_t, Body3DSW *> bodies;
+	for (const Set<CollisionObject3DSW *>::Element *E = objects.front(); E; E = E->next()) {
+		if (E->get()->get_type() == CollisionObject3DSW::TYPE_BODY) {
+			bodies.set(E->get()->get_self().get_id(), static_cast<Body3DSW *>(E->get()));
+		}
+	}
+
+	// Bodies removed since the snapshot are ignored, bodies added since keep their current state.
+	for (uint32_t body_index = 0; body_index < header.body_count; ++body_index) {
+		_SnapshotBody record;
+		memcpy(&record, r + body_offset + body_index * sizeof(_SnapshotBody), sizeof(_SnapshotBody));
+		Body3DSW **body = bodies.getptr(record.id);
+		if (body) {
+			(*body)->load_state(record.state);
+		}
+	}
+
+	// Pair the bodies at their restored positions, then restore the pairs' contacts.
+	broadphase->update();
+
+	for (const uint64_t *K = bodies.next(nullptr); K; K = bodies.next(K)) {
+		Body3DSW *body = bodies[*K];
+		const Map<Constraint3DSW *, int> &constraint_map = body->get_constraint_map();
+		for (const Map<Constraint3DSW *, int>::Element *E = constraint_map.front(); E; E = E->next()) {
+			if (E->get() != 0) {
+				continue; // Restored with the first body.
+			}
+			Constraint3DSW *constraint = E->key();
+			const Map<Constraint3DSW::Key, uint32_t>::Element *O = constraint_offsets.find(constraint->get_key());
+			if (O) {
+				_SnapshotConstraint record;
+				memcpy(&record, r + O->get(), sizeof(_SnapshotConstraint));
+				constraint->load_state(r + O->get() + sizeof(_SnapshotConstraint), record.state_size);
+			} else {
+				constraint->load_state(nullptr, 0);
+			}
+		}
+	}
+
+	return OK;
+}
+
 PhysicsDirectSpaceState3DSW *Space3DSW::get_direct_state() {
 	return direct_access;
 }
@@ -1275,6 +1551,7 @@ Space3DSW::Space3DSW() {
 	contact_debug_count = 0;
 
 	locked = false;
+	deterministic = false;
 	contact_recycle_radius = 0.01;
 	contact_max_separation = 0.05;
 	contact_max_allowed_penetration = 0.01;
@@ -39,17 +39,40 @@
 #include "collision_object_3d_sw.h"
 #include "core/config/project_settings.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/typedefs.h"
 #include "soft_body_3d_sw.h"
 
 class PhysicsDirectSpaceState3DSW : public PhysicsDirectSpaceState3D {
 	GDCLASS(PhysicsDirectSpaceState3DSW, PhysicsDirectSpaceState3D);
 
+	// Batched rays are culled against the broadphase first, then their shapes are intersected on worker threads.
+	struct RayCandidate {
+		const CollisionObject3DSW *object = nullptr;
+		int shape = 0;
+	};
+
+	struct RayHit {
+		Vector3 position;
+		Vector3 normal;
+		const CollisionObject3DSW *object = nullptr;
+		int shape = 0;
+	};
+
+	LocalVector<RayCandidate> ray_candidates;
+	LocalVector<uint32_t> ray_candidate_offsets;
+	LocalVector<RayHit> ray_hits;
+	const Vector3 *ray_from = nullptr;
+	const Vector3 *ray_to = nullptr;
+
+	void _intersect_batch_ray(uint32_t p_ray_index, void *p_userdata = nullptr);
+
 public:
 	Space3DSW *space;
 
 	virtual int intersect_point(const Vector3 &p_point, ShapeResult *r_results, int p_result_max, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false) override;
 	virtual bool intersect_ray(const Vector3 &p_from, const Vector3 &p_to, RayResult &r_result, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false, bool p_pick_ray = false) override;
+	virtual int intersect_rays(const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false) override;
 	virtual int intersect_shape(const RID &p_shape, const Transform &p_xform, real_t p_margin, ShapeResult *r_results, int p_result_max, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false) override;
 	virtual bool cast_motion(const RID &p_shape, const Transform &p_xform, const Vector3 &p_motion, real_t p_margin, real_t &p_closest_safe, real_t &p_closest_unsafe, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false, ShapeRestInfo *r_info = nullptr) override;
 	virtual bool collide_shape(RID p_shape, const Transform &p_shape_xform, real_t p_margin, Vector3 *r_results, int p_result_max, int &r_result_count, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false) override;
@@ -111,6 +134,7 @@ private:
 	real_t body_angular_velocity_damp_ratio;
 
 	bool locked;
+	bool deterministic;
 
 	int island_count;
 	int active_objects;
@@ -174,6 +198,13 @@ public:
 	void lock();
 	void unlock();
 
+	// Constraints are solved in a stable order, so the same inputs always give the same results.
+	void set_deterministic(bool p_deterministic) { deterministic = p_deterministic; }
+	bool is_deterministic() const { return deterministic; }
+
+	Vector<uint8_t> save_snapshot() const;
+	Error restore_snapshot(const Vector<uint8_t> &p_snapshot);
+
 	void set_param(PhysicsServer3D::SpaceParameter p_param, real_t p_value);
 	real_t get_param(PhysicsServer3D::SpaceParameter p_param) const;
 
@@ -43,20 +43,57 @@ class Step3DSW {
 	real_t delta = 0.0;
 
 	ThreadWorkPool work_pool;
+	// Deterministic spaces are stepped on the calling thread only, so thread scheduling can't change the results.
+	bool single_threaded = false;
 
+	LocalVector<Body3DSW *> active_bodies;
 	LocalVector<LocalVector<Body3DSW *>> body_islands;
 	LocalVector<LocalVector<Constraint3DSW *>> constraint_islands;
+	LocalVector<Constraint3DSW *> narrowphase_constraints;
 	LocalVector<Constraint3DSW *> all_constraints;
 
+	LocalVector<uint32_t> constraint_colors;
+	LocalVector<Constraint3DSW *> colored_constraints;
+	LocalVector<uint32_t> solver_batches;
+	uint32_t solver_serial_batch_begin = 0;
+	Constraint3DSW **solver_batch = nullptr;
+
+	template <class M>
+	void _do_work(uint32_t p_count, M p_method) {
+		if (single_threaded) {
+			for (uint32_t i = 0; i < p_count; i++) {
+				(this->*p_method)(i, nullptr);
+			}
+		} else {
+			work_pool.do_work(p_count, this, p_method, nullptr);
+		}
+	}
+
+	void _update_active_bodies(const SelfList<Body3DSW>::List *p_body_list);
+	void _integrate_forces(uint32_t p_body_index, void *p_userdata = nullptr);
+	void _integrate_velocities(uint32_t p_body_index, void *p_userdata = nullptr);
+	void _apply_integration();
 	void _populate_island(Body3DSW *p_body, LocalVector<Body3DSW *> &p_body_island, LocalVector<Constraint3DSW *> &p_constraint_island);
 	void _populate_island_soft_body(SoftBody3DSW *p_soft_body, LocalVector<Body3DSW *> &p_body_island, LocalVector<Constraint3DSW *> &p_constraint_island);
+	void _setup_narrowphase_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
+	void _apply_time_of_impact(Body3DSW *p_body) const;
+	bool _add_island_constraint(Constraint3DSW *p_constraint, LocalVector<Constraint3DSW *> &p_constraint_island);
 	void _setup_contraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<Constraint3DSW *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
+	void _solve_large_island(uint32_t p_island_index);
+	bool _color_island(LocalVector<Constraint3DSW *> &p_constraint_island);
+	void _solve_batch_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
+	void _solve_island_batches(LocalVector<Constraint3DSW *> &p_constraint_island);
+	void _solve_constraints(LocalVector<Constraint3DSW *> &p_constraint_island, bool p_batched);
 	void _check_suspend(const LocalVector<Body3DSW *> &p_body_island) const;
 
 public:
 	void step(Space3DSW *p_space, real_t p_delta, int p_iterations);
+
+	// Also used by direct space state queries, which only run while no space is being stepped.
+	ThreadWorkPool &get_work_pool() { return work_pool; }
+
 	Step3DSW();
 	~Step3DSW();
 };
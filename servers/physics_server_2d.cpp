@@ -88,6 +88,7 @@ void PhysicsDirectBodyState2D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("set_transform", "transform"), &PhysicsDirectBodyState2D::set_transform);
 	ClassDB::bind_method(D_METHOD("get_transform"), &PhysicsDirectBodyState2D::get_transform);
+	ClassDB::bind_method(D_METHOD("get_previous_transform"), &PhysicsDirectBodyState2D::get_previous_transform);
 
 	ClassDB::bind_method(D_METHOD("add_central_force", "force"), &PhysicsDirectBodyState2D::add_central_force);
 	ClassDB::bind_method(D_METHOD("add_force", "force", "position"), &PhysicsDirectBodyState2D::add_force, Vector2());
@@ -125,6 +126,7 @@ void PhysicsDirectBodyState2D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "linear_velocity"), "set_linear_velocity", "get_linear_velocity");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "sleeping"), "set_sleep_state", "is_sleeping");
 	ADD_PROPERTY(PropertyInfo(Variant::TRANSFORM2D, "transform"), "set_transform", "get_transform");
+	ADD_PROPERTY(PropertyInfo(Variant::TRANSFORM2D, "previous_transform"), "", "get_previous_transform");
 }
 
 PhysicsDirectBodyState2D::PhysicsDirectBodyState2D() {}
@@ -287,6 +289,85 @@ Dictionary PhysicsDirectSpaceState2D::_intersect_ray(const Vector2 &p_from, cons
 	return d;
 }
 
+Dictionary PhysicsDirectSpaceState2D::_intersect_rays(const PackedVector2Array &p_from, const PackedVector2Array &p_to, const Vector<RID> &p_exclude, uint32_t p_layers, bool p_collide_with_bodies, bool p_collide_with_areas) {
+	ERR_FAIL_COND_V_MSG(p_from.size() != p_to.size(), Dictionary(), "The 'from' and 'to' arrays must have the same size.");
+
+	Set<RID> exclude;
+	for (int i = 0; i < p_exclude.size(); i++) {
+		exclude.insert(p_exclude[i]);
+	}
+
+	int ray_count = p_from.size();
+	Vector<RayResult> results;
+	results.resize(ray_count);
+	intersect_rays(p_from.ptr(), p_to.ptr(), ray_count, results.ptrw(), exclude, p_layers, p_collide_with_bodies, p_collide_with_areas);
+
+	// Results are returned as packed arrays, to avoid allocating a dictionary per ray.
+	PackedVector2Array position;
+	position.resize(ray_count);
+	PackedVector2Array normal;
+	normal.resize(ray_count);
+	PackedInt64Array collider_id;
+	collider_id.resize(ray_count);
+	Array collider;
+	collider.resize(ray_count);
+	PackedInt32Array shape;
+	shape.resize(ray_count);
+	Array rid;
+	rid.resize(ray_count);
+	Array metadata;
+	metadata.resize(ray_count);
+
+	Vector2 *position_ptrw = position.ptrw();
+	Vector2 *normal_ptrw = normal.ptrw();
+	int64_t *collider_id_ptrw = collider_id.ptrw();
+	int32_t *shape_ptrw = shape.ptrw();
+	for (int i = 0; i < ray_count; i++) {
+		if (!results[i].rid.is_valid()) {
+			position_ptrw[i] = p_to[i];
+			normal_ptrw[i] = Vector2();
+			collider_id_ptrw[i] = 0;
+			shape_ptrw[i] = -1;
+			continue;
+		}
+
+		position_ptrw[i] = results[i].position;
+		normal_ptrw[i] = results[i].normal;
+		collider_id_ptrw[i] = int64_t(results[i].collider_id);
+		collider[i] = results[i].collider;
+		shape_ptrw[i] = results[i].shape;
+		rid[i] = results[i].rid;
+		metadata[i] = results[i].metadata;
+	}
+
+	Dictionary d;
+	d["position"] = position;
+	d["normal"] = normal;
+	d["collider_id"] = collider_id;
+	d["collider"] = collider;
+	d["shape"] = shape;
+	d["rid"] = rid;
+	d["metadata"] = metadata;
+
+	return d;
+}
+
+int PhysicsDirectSpaceState2D::intersect_rays(const Vector2 *p_from, const Vector2 *p_to, int p_ray_count, RayResult *r_results, const Set<RID> &p_exclude, uint32_t p_collision_layer, bool p_collide_with_bodies, bool p_collide_with_areas) {
+	int hit_count = 0;
+	for (int i = 0; i < p_ray_count; i++) {
+		if (intersect_ray(p_from[i], p_to[i], r_results[i], p_exclude, p_collision_layer, p_collide_with_bodies, p_collide_with_areas)) {
+			hit_count++;
+		} else {
+			r_results[i].rid = RID();
+			r_results[i].collider_id = ObjectID();
+			r_results[i].collider = nullptr;
+			r_results[i].shape = -1;
+			r_results[i].metadata = Variant();
+		}
+	}
+	return hit_count;
+}
+
 Array PhysicsDirectSpaceState2D::_intersect_shape(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query, int p_max_results) {
 	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Array());
 
@@ -412,6 +493,7 @@ void PhysicsDirectSpaceState2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("intersect_point", "point", "max_results", "exclude", "collision_layer", "collide_with_bodies", "collide_with_areas"), &PhysicsDirectSpaceState2D::_intersect_point, DEFVAL(32), DEFVAL(Array()), DEFVAL(0x7FFFFFFF), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("intersect_point_on_canvas", "point", "canvas_instance_id", "max_results", "exclude", "collision_layer", "collide_with_bodies", "collide_with_areas"), &PhysicsDirectSpaceState2D::_intersect_point_on_canvas, DEFVAL(32), DEFVAL(Array()), DEFVAL(0x7FFFFFFF), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("intersect_ray", "from", "to", "exclude", "collision_layer", "collide_with_bodies", "collide_with_areas"), &PhysicsDirectSpaceState2D::_intersect_ray, DEFVAL(Array()), DEFVAL(0x7FFFFFFF), DEFVAL(true), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("intersect_rays", "from", "to", "exclude", "collision_layer", "collide_with_bodies", "collide_with_areas"), &PhysicsDirectSpaceState2D::_intersect_rays, DEFVAL(Array()), DEFVAL(0x7FFFFFFF), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("intersect_shape", "shape", "max_results"), &PhysicsDirectSpaceState2D::_intersect_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("cast_motion", "shape"), &PhysicsDirectSpaceState2D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "shape", "max_results"), &PhysicsDirectSpaceState2D::_collide_shape, DEFVAL(32));
@@ -545,6 +627,10 @@ void PhysicsServer2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("space_is_active", "space"), &PhysicsServer2D::space_is_active);
 	ClassDB::bind_method(D_METHOD("space_set_param", "space", "param", "value"), &PhysicsServer2D::space_set_param);
 	ClassDB::bind_method(D_METHOD("space_get_param", "space", "param"), &PhysicsServer2D::space_get_param);
+	ClassDB::bind_method(D_METHOD("space_set_deterministic", "space", "deterministic"), &PhysicsServer2D::space_set_deterministic);
+	ClassDB::bind_method(D_METHOD("space_is_deterministic", "space"), &PhysicsServer2D::space_is_deterministic);
+	ClassDB::bind_method(D_METHOD("space_save_snapshot", "space"), &PhysicsServer2D::space_save_snapshot);
+	ClassDB::bind_method(D_METHOD("space_restore_snapshot", "space", "snapshot"), &PhysicsServer2D::space_restore_snapshot);
 	ClassDB::bind_method(D_METHOD("space_get_direct_state", "space"), &PhysicsServer2D::space_get_direct_state);
 
 	ClassDB::bind_method(D_METHOD("area_create"), &PhysicsServer2D::area_create);
@@ -756,6 +842,11 @@ void PhysicsServer2D::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_ACTIVE_OBJECTS);
 	BIND_ENUM_CONSTANT(INFO_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(INFO_ISLAND_COUNT);
+	BIND_ENUM_CONSTANT(INFO_INTEGRATE_FORCES_TIME);
+	BIND_ENUM_CONSTANT(INFO_GENERATE_ISLANDS_TIME);
+	BIND_ENUM_CONSTANT(INFO_SETUP_CONSTRAINTS_TIME);
+	BIND_ENUM_CONSTANT(INFO_SOLVE_CONSTRAINTS_TIME);
+	BIND_ENUM_CONSTANT(INFO_INTEGRATE_VELOCITIES_TIME);
 }
 
 PhysicsServer2D::PhysicsServer2D() {
@@ -0,0 +1,290 @@
+/*************************************************************************/
+/*  test_heightmap_shape_3d.h                                            */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_HEIGHTMAP_SHAPE_3D_H
+#define TEST_HEIGHTMAP_SHAPE_3D_H
+
+#include "core/math/random_pcg.h"
+#include "core/os/os.h"
+#include "servers/physics_3d/shape_3d_sw.h"
+#include "tests/test_macros.h"
+
+namespace TestHeightMapShape3D {
+
+static void _setup_heightmap(HeightMapShape3DSW &r_shape, int p_width, int p_depth) {
+	// Rolling hills, with a few cliffs to get empty and full blocks.
+	Vector<float> heights;
+	heights.resize(p_width * p_depth);
+	float *heights_ptr = heights.ptrw();
+	for (int z = 0; z < p_depth; z++) {
+		for (int x = 0; x < p_width; x++) {
+			float height = Math::sin(x * 0.05) * 10.0 + Math::cos(z * 0.08) * 6.0;
+			if ((x / 37 + z / 23) % 5 == 0) {
+				height += 25.0;
+			}
+			heights_ptr[(z * p_width) + x] = height;
+		}
+	}
+
+	Dictionary data;
+	data["width"] = p_width;
+	data["depth"] = p_depth;
+	data["heights"] = heights;
+	r_shape.set_data(data);
+}
+
+static bool _intersect_segment_brute_force(const HeightMapShape3DSW &p_shape, const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point) {
+	FaceShape3DSW face;
+	face.backface_collision = false;
+
+	bool hit = false;
+	real_t closest_distance = 1e20;
+	for (int z = 0; z < p_shape.depth - 1; z++) {
+		for (int x = 0; x < p_shape.width - 1; x++) {
+			for (int i = 0; i < 2; i++) {
+				if (i == 0) {
+					p_shape._get_point(x, z, face.vertex[0]);
+					p_shape._get_point(x + 1, z, face.vertex[1]);
+					p_shape._get_point(x, z + 1, face.vertex[2]);
+				} else {
+					p_shape._get_point(x + 1, z, face.vertex[0]);
+					p_shape._get_point(x + 1, z + 1, face.vertex[1]);
+					p_shape._get_point(x, z + 1, face.vertex[2]);
+				}
+				face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
+
+				Vector3 point, normal;
+				if (face.intersect_segment(p_begin, p_end, point, normal)) {
+					real_t distance = p_begin.distance_to(point);
+					if (distance < closest_distance) {
+						closest_distance = distance;
+						r_point = point;
+						hit = true;
+					}
+				}
+			}
+		}
+	}
+
+	return hit;
+}
+
+struct CullResult {
+	AABB aabb;
+	int intersecting_faces = 0;
+};
+
+static void _count_intersecting_faces(void *p_userdata, Shape3DSW *p_convex) {
+	CullResult &result = *(CullResult *)p_userdata;
+	FaceShape3DSW *face = static_cast<FaceShape3DSW *>(p_convex);
+
+	AABB face_aabb(face->vertex[0], Vector3());
+	face_aabb.expand_to(face->vertex[1]);
+	face_aabb.expand_to(face->vertex[2]);
+	if (face_aabb.intersects_inclusive(result.aabb)) {
+		result.intersecting_faces++;
+	}
+}
+
+static int _count_intersecting_faces_brute_force(const HeightMapShape3DSW &p_shape, const AABB &p_aabb) {
+	int count = 0;
+	for (int z = 0; z < p_shape.depth - 1; z++) {
+		for (int x = 0; x < p_shape.width - 1; x++) {
+			Vector3 points[4];
+			p_shape._get_point(x, z, points[0]);
+			p_shape._get_point(x + 1, z, points[1]);
+			p_shape._get_point(x, z + 1, points[2]);
+			p_shape._get_point(x + 1, z + 1, points[3]);
+
+			for (int i = 0; i < 2; i++) {
+				AABB face_aabb(points[i], Vector3());
+				face_aabb.expand_to(points[i + 1]);
+				face_aabb.expand_to(points[i + 2]);
+				if (face_aabb.intersects_inclusive(p_aabb)) {
+					count++;
+				}
+			}
+		}
+	}
+	return count;
+}
+
+TEST_CASE("[HeightMapShape3D] Segment intersection") {
+	HeightMapShape3DSW shape;
+	_setup_heightmap(shape, 150, 110);
+
+	RandomPCG rng(1234);
+	const AABB &aabb = shape.get_aabb();
+
+	for (int i = 0; i < 200; i++) {
+		// Segments of all lengths and slopes, some starting outside of the heightmap.
+		Vector3 begin = aabb.position + Vector3(rng.random(-0.2, 1.2), rng.random(0.0, 1.5), rng.random(-0.2, 1.2)) * aabb.size;
+		Vector3 end = aabb.position + Vector3(rng.random(-0.2, 1.2), rng.random(-0.5, 1.0), rng.random(-0.2, 1.2)) * aabb.size;
+		if (i % 4 == 0) {
+			end.x = begin.x;
+			end.z = begin.z;
+		}
+
+		Vector3 point, normal;
+		bool hit = shape.intersect_segment(begin, end, point, normal);
+
+		Vector3 expected_point;
+		bool expected_hit = _intersect_segment_brute_force(shape, begin, end, expected_point);
+
+		CHECK_MESSAGE(hit == expected_hit, "Segment intersections should match the ones of all the faces.");
+		if (hit && expected_hit) {
+			CHECK_MESSAGE(point.is_equal_approx(expected_point), "Segment intersections should be the closest to the segment begin.");
+		}
+	}
+
+	Vector3 point, normal;
+	CHECK_MESSAGE(!shape.intersect_segment(Vector3(-1000, 100, 0), Vector3(1000, 100, 0), point, normal), "Segments above the heightmap should not intersect it.");
+	CHECK_MESSAGE(!shape.intersect_segment(Vector3(-1000, 0, 0), Vector3(-500, 0, 100), point, normal), "Segments beside the heightmap should not intersect it.");
+}
+
+TEST_CASE("[HeightMapShape3D] Cull") {
+	HeightMapShape3DSW shape;
+	_setup_heightmap(shape, 150, 110);
+
+	RandomPCG rng(4321);
+	const AABB &aabb = shape.get_aabb();
+
+	for (int i = 0; i < 50; i++) {
+		CullResult result;
+		result.aabb.position = aabb.position + Vector3(rng.random(-0.2, 1.0), rng.random(-0.2, 1.0), rng.random(-0.2, 1.0)) * aabb.size;
+		result.aabb.size = Vector3(rng.random(0.0, 0.5), rng.random(0.0, 0.5), rng.random(0.0, 0.5)) * aabb.size;
+
+		shape.cull(result.aabb, _count_intersecting_faces, &result);
+
+		CHECK_MESSAGE(result.intersecting_faces == _count_intersecting_faces_brute_force(shape, result.aabb), "Cull should report all the faces touching the AABB.");
+	}
+}
+
+TEST_CASE("[HeightMapShape3D] Project range") {
+	HeightMapShape3DSW shape;
+	_setup_heightmap(shape, 150, 110);
+
+	RandomPCG rng(5678);
+
+	for (int i = 0; i < 20; i++) {
+		Vector3 normal = Vector3(rng.random(-1.0, 1.0), rng.random(-1.0, 1.0), rng.random(-1.0, 1.0)).normalized();
+		Transform transform(Basis(Vector3(0, 1, 0), rng.random(0.0, Math_TAU)), Vector3(rng.random(-100.0, 100.0), 0, 0));
+
+		real_t min, max;
+		shape.project_range(normal, transform, min, max);
+
+		real_t aabb_min, aabb_max;
+		transform.xform(shape.get_aabb()).project_range_in_plane(Plane(normal, 0), aabb_min, aabb_max);
+
+		real_t points_min = 1e20;
+		real_t points_max = -1e20;
+		for (int z = 0; z < shape.depth; z++) {
+			for (int x = 0; x < shape.width; x++) {
+				Vector3 point;
+				shape._get_point(x, z, point);
+				real_t d = normal.dot(transform.xform(point));
+				points_min = MIN(points_min, d);
+				points_max = MAX(points_max, d);
+			}
+		}
+
+		// Some blocks touch the extreme points, allow for rounding errors.
+		const real_t tolerance = 0.001;
+		CHECK_MESSAGE(min <= points_min + tolerance, "The projected range should contain all the points.");
+		CHECK_MESSAGE(max >= points_max - tolerance, "The projected range should contain all the points.");
+		CHECK_MESSAGE(min >= aabb_min - tolerance, "The projected range should be within the one of the AABB.");
+		CHECK_MESSAGE(max <= aabb_max + tolerance, "The projected range should be within the one of the AABB.");
+	}
+}
+
+static void _count_faces(void *p_userdata, Shape3DSW *p_convex) {
+	(*(int *)p_userdata)++;
+}
+
+// Benchmark of the queries on a large heightmap.
+// Usage: `godot --test heightmap-benchmark`.
+static void benchmark_heightmap() {
+	const int size = 4096;
+
+	uint64_t begin_time = OS::get_singleton()->get_ticks_usec();
+	HeightMapShape3DSW shape;
+	_setup_heightmap(shape, size, size);
+	print_line(vformat("Setup of a %dx%d heightmap: %d msec.", size, size, (OS::get_singleton()->get_ticks_usec() - begin_time) / 1000));
+
+	RandomPCG rng(1234);
+	const AABB &aabb = shape.get_aabb();
+	const int query_count = 10000;
+
+	// Rays going down, like ground checks.
+	int hits = 0;
+	begin_time = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < query_count; i++) {
+		Vector3 begin = aabb.position + Vector3(rng.randf(), 1.0, rng.randf()) * aabb.size;
+		Vector3 end = begin - Vector3(0, aabb.size.y, 0);
+		Vector3 point, normal;
+		hits += shape.intersect_segment(begin, end, point, normal) ? 1 : 0;
+	}
+	print_line(vformat("%d vertical rays: %d usec (%d hits).", query_count, OS::get_singleton()->get_ticks_usec() - begin_time, hits));
+
+	// Long rays across the terrain, like line of sight checks.
+	hits = 0;
+	begin_time = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < query_count; i++) {
+		Vector3 begin = aabb.position + Vector3(rng.randf(), rng.random(0.5, 1.0), rng.randf()) * aabb.size;
+		Vector3 end = aabb.position + Vector3(rng.randf(), rng.random(0.0, 1.0), rng.randf()) * aabb.size;
+		Vector3 point, normal;
+		hits += shape.intersect_segment(begin, end, point, normal) ? 1 : 0;
+	}
+	print_line(vformat("%d long rays: %d usec (%d hits).", query_count, OS::get_singleton()->get_ticks_usec() - begin_time, hits));
+
+	// Wide boxes, like shape casts and large bodies resting on the terrain.
+	int faces = 0;
+	begin_time = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < query_count / 10; i++) {
+		Vector3 position = aabb.position + Vector3(rng.randf(), rng.randf(), rng.randf()) * aabb.size;
+		shape.cull(AABB(position, Vector3(64, 4, 64)), _count_faces, &faces);
+	}
+	print_line(vformat("%d wide culls: %d usec (%d faces).", query_count / 10, OS::get_singleton()->get_ticks_usec() - begin_time, faces));
+
+	begin_time = OS::get_singleton()->get_ticks_usec();
+	real_t min = 0.0;
+	real_t max = 0.0;
+	for (int i = 0; i < query_count; i++) {
+		Vector3 normal = Vector3(rng.random(-1.0, 1.0), rng.random(-1.0, 1.0), rng.random(-1.0, 1.0)).normalized();
+		shape.project_range(normal, Transform(), min, max);
+	}
+	print_line(vformat("%d range projections: %d usec.", query_count, OS::get_singleton()->get_ticks_usec() - begin_time));
+}
+
+REGISTER_TEST_COMMAND("heightmap-benchmark", &benchmark_heightmap);
+
+} // namespace TestHeightMapShape3D
+
+#endif // TEST_HEIGHTMAP_SHAPE_3D_H
@@ -32,6 +32,9 @@
 #define TEST_JSON_H
 
 #include "core/io/json.h"
+#include "core/os/dir_access.h"
+#include "core/os/file_access.h"
+#include "core/os/os.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -161,6 +164,111 @@ TEST_CASE("[JSON] Parsing objects (dictionaries)") {
 			dictionary["empty_object"].hash() == Dictionary().hash(),
 			"The parsed JSON should contain the expected values.");
 }
+
+TEST_CASE("[JSON] Parsing UTF-8 buffers") {
+	const String text = R"({"name": "Godot Engine \u00e9\ud83c\udfa4", "version": 4, "ratio": -0.125, "big": 1.5e300, "list": [1, 2.5, true, null, [], {}], "nested": {"a": {"b": ["c"]}}})";
+	const CharString utf8 = text.utf8();
+
+	Variant expected;
+	Variant result;
+	String err_str;
+	int err_line;
+
+	REQUIRE(JSON::parse(text, expected, err_str, err_line) == OK);
+	CHECK_MESSAGE(
+			JSON::parse_utf8((const uint8_t *)utf8.get_data(), utf8.length(), result, err_str, err_line) == OK,
+			"Parsing UTF-8 JSON should parse successfully.");
+	CHECK_MESSAGE(
+			err_line == 0,
+			"Parsing UTF-8 JSON should parse successfully.");
+	CHECK_MESSAGE(
+			JSON::print(result) == JSON::print(expected),
+			"Parsing UTF-8 JSON should give the same result as parsing a String.");
+
+	const Dictionary dictionary = result;
+	CHECK_MESSAGE(
+			dictionary["name"] == String::utf8("Godot Engine \xc3\xa9\xf0\x9f\x8e\xa4"),
+			"Escaped characters should be decoded.");
+	CHECK_MESSAGE(
+			double(dictionary["ratio"]) == -0.125,
+			"Numbers should be parsed exactly.");
+	CHECK_MESSAGE(
+			double(dictionary["big"]) == 1.5e300,
+			"Numbers outside of the fast path range should be parsed.");
+
+	const CharString escaped_nul = String(R"(["a\u0000b"])").utf8();
+	REQUIRE(JSON::parse_utf8((const uint8_t *)escaped_nul.get_data(), escaped_nul.length(), result, err_str, err_line) == OK);
+	const String with_nul = Array(result)[0];
+	CHECK_MESSAGE(
+			with_nul.length() == 3,
+			"Escaped NUL characters should not end the string.");
+	CHECK(with_nul[1] == 0);
+	CHECK(with_nul[2] == 'b');
+
+	const CharString invalid = String("[1, 2\n{").utf8();
+	CHECK_MESSAGE(
+			JSON::parse_utf8((const uint8_t *)invalid.get_data(), invalid.length(), result, err_str, err_line) != OK,
+			"Parsing invalid UTF-8 JSON should fail.");
+	CHECK_MESSAGE(
+			err_line == 1,
+			"The line of the parse error should be reported.");
+	CHECK_MESSAGE(
+			result == Variant(),
+			"Parsing invalid UTF-8 JSON should return an empty Variant.");
+}
+
+TEST_CASE("[JSON] Writing with events") {
+	JSON::Writer writer;
+	writer.begin_object();
+	writer.key("items");
+	writer.begin_array();
+	writer.value(1);
+	writer.value("two");
+	writer.end_array();
+	writer.key("empty");
+	writer.value(Dictionary());
+	writer.end_object();
+
+	CHECK_MESSAGE(
+			writer.get_string() == R"({"items":[1,"two"],"empty":{}})",
+			"The writer should produce the expected JSON.");
+
+	Dictionary dictionary;
+	dictionary["b"] = Array();
+	dictionary["a"] = 1;
+	CHECK_MESSAGE(
+			JSON::print(dictionary, "\t") == "{\n\t\"a\": 1,\n\t\"b\": [\n\n\t]\n}",
+			"Printing with indentation should produce the expected JSON.");
+}
+
+TEST_CASE("[JSON] Writing to a file") {
+	// Large enough to be flushed in several chunks, with indentation making up a good part of the text.
+	Array items;
+	for (int i = 0; i < 5000; i++) {
+		Dictionary item;
+		item["index"] = i;
+		item["name"] = "Item " + itos(i);
+		items.push_back(item);
+	}
+
+	const String path = OS::get_singleton()->get_cache_path().plus_file("test_json_writer.json");
+	FileAccessRef f = FileAccess::open(path, FileAccess::WRITE);
+	REQUIRE(f);
+	CHECK_MESSAGE(
+			JSON::print_to_file(f, items, "\t") == OK,
+			"Printing to a file should succeed.");
+	f->close();
+
+	const String expected = JSON::print(items, "\t");
+	CHECK_MESSAGE(
+			expected.length() > 65536,
+			"The printed JSON should be larger than the writer's flush size.");
+	CHECK_MESSAGE(
+			FileAccess::get_file_as_string(path) == expected,
+			"Printing to a file should produce the same JSON as printing to a string.");
+
+	DirAccess::remove_file_or_error(path);
+}
 } // namespace TestJSON
 
 #endif // TEST_JSON_H
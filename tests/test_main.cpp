@@ -50,6 +50,7 @@
 #include "test_gradient.h"
 #include "test_gui.h"
 #include "test_hashing_context.h"
+#include "test_heightmap_shape_3d.h"
 #include "test_image.h"
 #include "test_json.h"
 #include "test_list.h"
@@ -58,19 +59,24 @@
 #include "test_marshalls.h"
 #include "test_math.h"
 #include "test_method_bind.h"
+#include "test_node.h"
 #include "test_node_path.h"
 #include "test_oa_hash_map.h"
 #include "test_object.h"
 #include "test_ordered_hash_map.h"
+#include "test_packed_scene.h"
 #include "test_paged_array.h"
 #include "test_path_3d.h"
 #include "test_pck_packer.h"
 #include "test_physics_2d.h"
 #include "test_physics_3d.h"
+#include "test_physics_benchmark.h"
+#include "test_physics_server.h"
 #include "test_random_number_generator.h"
 #include "test_rect2.h"
 #include "test_render.h"
 #include "test_resource.h"
+#include "test_self_list.h"
 #include "test_shader_lang.h"
 #include "test_string.h"
 #include "test_text_server.h"
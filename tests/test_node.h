@@ -0,0 +1,183 @@
+/*************************************************************************/
+/*  test_node.h                                                          */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_NODE_H
+#define TEST_NODE_H
+
+#include "core/os/os.h"
+#include "scene/main/node.h"
+#include "scene/resources/packed_scene.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode {
+
+TEST_CASE("[Node] Get children by name in a wide tree") {
+	Node *parent = memnew(Node);
+	const int child_count = 1000;
+	for (int i = 0; i < child_count; i++) {
+		Node *child = memnew(Node);
+		child->set_name("Child" + itos(i));
+		parent->add_child(child);
+	}
+
+	for (int i = 0; i < child_count; i++) {
+		Node *child = parent->get_node_or_null(NodePath("Child" + itos(i)));
+		REQUIRE(child);
+		CHECK(child->get_index() == i);
+	}
+	CHECK(parent->get_node_or_null(NodePath("Child" + itos(child_count))) == nullptr);
+
+	SUBCASE("Renamed children are found by their new name") {
+		Node *child = parent->get_child(10);
+		child->set_name("Renamed");
+		CHECK(parent->get_node_or_null(NodePath("Renamed")) == child);
+		CHECK(parent->get_node_or_null(NodePath("Child10")) == nullptr);
+
+		// Taking the name of a sibling makes it unique.
+		child->set_name("Child20");
+		CHECK(child->get_name() != StringName("Child20"));
+		CHECK(parent->get_node_or_null(NodePath("Child20")) == parent->get_child(20));
+		CHECK(parent->get_node_or_null(NodePath(child->get_name())) == child);
+	}
+
+	SUBCASE("Removed children are not found") {
+		Node *child = parent->get_child(5);
+		parent->remove_child(child);
+		CHECK(parent->get_node_or_null(NodePath("Child5")) == nullptr);
+		CHECK(parent->get_node_or_null(NodePath("Child6")) == parent->get_child(5));
+
+		// Its name can be used again.
+		Node *other = memnew(Node);
+		other->set_name("Child5");
+		parent->add_child(other);
+		CHECK(other->get_name() == StringName("Child5"));
+		CHECK(parent->get_node_or_null(NodePath("Child5")) == other);
+		memdelete(child);
+	}
+
+	SUBCASE("Added children with an existing name get a unique name") {
+		Node *child = memnew(Node);
+		child->set_name("Child3");
+		parent->add_child(child);
+		CHECK(child->get_name() != StringName("Child3"));
+		CHECK(parent->get_node_or_null(NodePath("Child3")) == parent->get_child(3));
+		CHECK(parent->get_node_or_null(NodePath(child->get_name())) == child);
+	}
+
+	memdelete(parent);
+}
+
+TEST_CASE("[Node] Get children by name when siblings share a name") {
+	// Names are not validated when instancing, so a scene can have siblings with the same name.
+	Ref<SceneState> state;
+	state.instance();
+	const int type = state->add_name("Node");
+	state->add_node(-1, -1, type, state->add_name("Root"), -1, -1);
+	const int shared_name = state->add_name("Shared");
+	state->add_node(0, 0, type, shared_name, -1, -1);
+	state->add_node(0, 0, type, shared_name, -1, -1);
+	for (int i = 0; i < 20; i++) {
+		state->add_node(0, 0, type, state->add_name("Child" + itos(i)), -1, -1);
+	}
+
+	Ref<PackedScene> scene;
+	scene.instance();
+	scene->replace_state(state);
+	Node *parent = scene->instance();
+	REQUIRE(parent);
+	REQUIRE(parent->get_child_count() == 22);
+
+	Node *first = parent->get_child(0);
+	Node *second = parent->get_child(1);
+	CHECK(parent->get_node_or_null(NodePath("Shared")) == first);
+
+	SUBCASE("Removing one keeps the other reachable") {
+		parent->remove_child(first);
+		CHECK(parent->get_node_or_null(NodePath("Shared")) == second);
+		memdelete(first);
+	}
+
+	SUBCASE("Removing the other keeps the first reachable") {
+		parent->remove_child(second);
+		CHECK(parent->get_node_or_null(NodePath("Shared")) == first);
+		memdelete(second);
+	}
+
+	SUBCASE("Renaming one keeps the other reachable") {
+		first->set_name("Renamed");
+		CHECK(parent->get_node_or_null(NodePath("Shared")) == second);
+		CHECK(parent->get_node_or_null(NodePath("Renamed")) == first);
+	}
+
+	memdelete(parent);
+}
+
+TEST_CASE("[Node] Get node in deep and wide trees") {
+	// A chain of nodes where every level also has many siblings.
+	Node *root = memnew(Node);
+	Node *current = root;
+	String path;
+	const int depth = 32;
+	const int width = 64;
+	for (int i = 0; i < depth; i++) {
+		Node *next = nullptr;
+		for (int j = 0; j < width; j++) {
+			Node *child = memnew(Node);
+			child->set_name("Node" + itos(j));
+			current->add_child(child);
+			if (j == width - 1) {
+				next = child;
+			}
+		}
+		path += (i > 0 ? "/Node" : "Node") + itos(width - 1);
+		current = next;
+	}
+
+	const NodePath node_path = path;
+	REQUIRE(root->get_node_or_null(node_path) == current);
+	CHECK(current->get_node_or_null(NodePath("../Node0")) == current->get_parent()->get_child(0));
+
+	const int lookups = 10000;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	int found = 0;
+	for (int i = 0; i < lookups; i++) {
+		found += root->get_node_or_null(node_path) == current;
+	}
+	uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+	CHECK(found == lookups);
+	MESSAGE(vformat("get_node() with %d levels of %d children: %.3f usec per call.", depth, width, double(elapsed) / lookups));
+
+	memdelete(root);
+}
+
+} // namespace TestNode
+
+#endif // TEST_NODE_H
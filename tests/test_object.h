@@ -33,6 +33,7 @@
 
 #include "core/core_string_names.h"
 #include "core/object/object.h"
+#include "core/os/os.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -54,6 +55,12 @@ protected:
 public:
 	void set_property(int value) { property_value = value; }
 	int get_property() const { return property_value; }
+	int get_property_twice() const { return property_value * 2; }
+	int get_property_thrice() const { return property_value * 3; }
+};
+
+class _TestSubDerivedObject : public _TestDerivedObject {
+	GDCLASS(_TestSubDerivedObject, _TestDerivedObject);
 };
 
 namespace TestObject {
@@ -86,7 +93,7 @@ public:
 		return false;
 	}
 	Variant call(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error) override {
-		return Variant();
+		return p_argcount;
 	}
 	void notification(int p_notification) override {
 	}
@@ -232,6 +239,22 @@ TEST_CASE("[Object] Script instance property getter") {
 			"The returned value should equal the one which was set by the script instance.");
 }
 
+TEST_CASE("[Object] Script instance call arguments") {
+	Object object;
+	_MockScriptInstance *script_instance = memnew(_MockScriptInstance);
+	object.set_script_instance(script_instance);
+
+	CHECK_MESSAGE(
+			object.call("some_method") == Variant(0),
+			"Calling without arguments should pass no arguments.");
+	CHECK_MESSAGE(
+			object.call("some_method", 1, "two", Variant(), Vector2()) == Variant(4),
+			"The variadic call should pass every argument, including null ones.");
+	CHECK_MESSAGE(
+			object.call("some_method", Variant(1), Variant(2), Variant(), Variant(), Variant()) == Variant(2),
+			"The five argument call should stop at the first null argument.");
+}
+
 TEST_CASE("[Object] Built-in property setter") {
 	ClassDB::register_class<_TestDerivedObject>();
 	_TestDerivedObject derived_object;
@@ -300,6 +323,136 @@ TEST_CASE("[Object] Absent name getter") {
 			actual_value == Variant(),
 			"The returned value should equal nil variant.");
 }
+
+TEST_CASE("[Object] Inherited members lookup") {
+	ClassDB::register_class<_TestDerivedObject>();
+
+	CHECK(ClassDB::get_method("_TestDerivedObject", "get_property") != nullptr);
+	CHECK(ClassDB::get_method("_TestDerivedObject", "get_instance_id") == ClassDB::get_method("Object", "get_instance_id"));
+	CHECK(ClassDB::get_method("_TestDerivedObject", "absent_method") == nullptr);
+	CHECK(ClassDB::get_method("Object", "get_property") == nullptr);
+
+	bool valid = false;
+	CHECK(ClassDB::get_property_index("_TestDerivedObject", "property", &valid) == -1);
+	CHECK(valid);
+
+	// Members registered after a lookup was made are found too.
+	CHECK(ClassDB::get_method("_TestDerivedObject", "get_property_twice") == nullptr);
+	ClassDB::bind_method(D_METHOD("get_property_twice"), &_TestDerivedObject::get_property_twice);
+	CHECK(ClassDB::get_method("_TestDerivedObject", "get_property_twice") != nullptr);
+
+	_TestDerivedObject derived_object;
+	derived_object.set_property(21);
+	CHECK(derived_object.call("get_property_twice") == Variant(42));
+}
+
+TEST_CASE("[Object] Members registered late in a base class") {
+	ClassDB::register_class<_TestDerivedObject>();
+	ClassDB::register_class<_TestSubDerivedObject>();
+
+	// Build the lookup of the subclass, as a reader would hold it.
+	CHECK(ClassDB::get_method("_TestSubDerivedObject", "get_property") != nullptr);
+	const ClassDB::MemberLookup *previous_lookup = ClassDB::classes.getptr("_TestSubDerivedObject")->member_lookup.ptr.load();
+	REQUIRE(previous_lookup);
+
+	CHECK(ClassDB::get_method("_TestSubDerivedObject", "get_property_thrice") == nullptr);
+	ClassDB::bind_method(D_METHOD("get_property_thrice"), &_TestDerivedObject::get_property_thrice);
+	CHECK_MESSAGE(
+			ClassDB::get_method("_TestSubDerivedObject", "get_property_thrice") != nullptr,
+			"Members bound to a base class should be found through its subclasses.");
+	CHECK_MESSAGE(
+			previous_lookup->method_map.has("get_property"),
+			"Replaced lookups should stay readable until cleanup.");
+
+	_TestSubDerivedObject sub_derived_object;
+	sub_derived_object.set_property(7);
+	CHECK(sub_derived_object.call("get_property_thrice") == Variant(21));
+}
+
+TEST_CASE("[Object] Set, get and call by name") {
+	ClassDB::register_class<_TestDerivedObject>();
+	_TestDerivedObject derived_object;
+
+	const StringName property = "property";
+	const StringName getter = "get_property";
+	const int iterations = 100000;
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		derived_object.set(property, i);
+	}
+	uint64_t set_usec = OS::get_singleton()->get_ticks_usec() - begin;
+	CHECK(derived_object.get_property() == iterations - 1);
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	int64_t sum = 0;
+	for (int i = 0; i < iterations; i++) {
+		sum += int64_t(derived_object.get(property));
+	}
+	uint64_t get_usec = OS::get_singleton()->get_ticks_usec() - begin;
+	CHECK(sum == int64_t(iterations - 1) * iterations);
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	sum = 0;
+	for (int i = 0; i < iterations; i++) {
+		sum += int64_t(derived_object.call(getter));
+	}
+	uint64_t call_usec = OS::get_singleton()->get_ticks_usec() - begin;
+	CHECK(sum == int64_t(iterations - 1) * iterations);
+
+	MESSAGE(vformat("Per %d calls: set() %d usec, get() %d usec, call() %d usec.", iterations, set_usec, get_usec, call_usec));
+}
+
+TEST_CASE("[Object] Property change tracking") {
+	ClassDB::register_class<_TestDerivedObject>();
+	_TestDerivedObject derived_object;
+
+	derived_object.set("property", 1);
+	CHECK_FALSE(derived_object.is_tracking_property_changes());
+	CHECK_FALSE(derived_object.has_changed_properties());
+
+	derived_object.set_track_property_changes(true);
+	derived_object.set("property", 2);
+	derived_object.set("property", 3);
+	derived_object.set("absent_property", 4);
+
+	List<StringName> changed;
+	derived_object.get_changed_properties(&changed);
+	CHECK_MESSAGE(
+			changed.size() == 1,
+			"A property set several times should be reported once, absent ones not at all.");
+	CHECK(changed.front()->get() == "property");
+
+	derived_object.clear_changed_properties();
+	CHECK_FALSE(derived_object.has_changed_properties());
+
+	bool valid = false;
+	CHECK(ClassDB::set_property(&derived_object, "property", 5, &valid));
+	CHECK(valid);
+	CHECK_MESSAGE(
+			derived_object.has_changed_properties(),
+			"Properties set through ClassDB directly should be reported too.");
+	derived_object.clear_changed_properties();
+
+	Object object;
+	_MockScriptInstance *script_instance = memnew(_MockScriptInstance);
+	object.set_script_instance(script_instance);
+	object.set_track_property_changes(true);
+	object.set("script_member", 5);
+	object.mark_property_changed("other_member");
+	object.set("script_member", 6);
+
+	changed.clear();
+	object.get_changed_properties(&changed);
+	CHECK(changed.size() == 2);
+	CHECK_MESSAGE(
+			changed.front()->get() == "script_member",
+			"Script members set through the object should be reported, in the order they first changed.");
+	CHECK(changed.back()->get() == "other_member");
+
+	object.set_track_property_changes(false);
+	CHECK_FALSE(object.has_changed_properties());
+}
 } // namespace TestObject
 
 #endif // TEST_OBJECT_H
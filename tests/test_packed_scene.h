@@ -0,0 +1,124 @@
+/*************************************************************************/
+/*  test_packed_scene.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+#ifndef TEST_PACKED_SCENE_H
+#define TEST_PACKED_SCENE_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/resources/packed_scene.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPackedScene {
+
+static Ref<PackedScene> _make_scene() {
+	Node2D *root = memnew(Node2D);
+	root->set_name("Root");
+	root->add_to_group("packed", true);
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_position(Vector2(5, 0));
+	root->add_child(child);
+	child->set_owner(root);
+
+	Ref<PackedScene> scene;
+	scene.instance();
+	CHECK(scene->pack(root) == OK);
+	memdelete(root);
+	return scene;
+}
+
+TEST_CASE("[PackedScene] Instance multiple") {
+	Ref<PackedScene> scene = _make_scene();
+
+	TypedArray<Node> instances = scene->instance_multiple(3);
+	REQUIRE(instances.size() == 3);
+	for (int i = 0; i < instances.size(); i++) {
+		Node2D *root = Object::cast_to<Node2D>(instances[i]);
+		REQUIRE(root);
+		CHECK(root->is_in_group("packed"));
+		Node2D *child = Object::cast_to<Node2D>(root->get_node_or_null(NodePath("Child")));
+		REQUIRE(child);
+		CHECK(child->get_position() == Vector2(5, 0));
+		for (int j = 0; j < i; j++) {
+			CHECK_MESSAGE(instances[j] != instances[i], "Every instance should be a different node.");
+		}
+	}
+
+	for (int i = 0; i < instances.size(); i++) {
+		memdelete(Object::cast_to<Node>(instances[i]));
+	}
+}
+
+TEST_CASE("[PackedScene] Pooled instances are reset when reused") {
+	Ref<PackedScene> scene = _make_scene();
+	scene->set_pool_size(1);
+
+	Node2D *root = Object::cast_to<Node2D>(scene->instance_pooled());
+	REQUIRE(root);
+	Node2D *child = Object::cast_to<Node2D>(root->get_node_or_null(NodePath("Child")));
+	REQUIRE(child);
+
+	// A stored property, and properties which were not stored because they had their default value.
+	child->set_position(Vector2(1, 2));
+	child->set_rotation(1.0);
+	root->set_z_index(3);
+
+	REQUIRE(scene->recycle(root));
+	CHECK(scene->instance_pooled() == root);
+	CHECK(child->get_position() == Vector2(5, 0));
+	CHECK(child->get_rotation() == 0.0);
+	CHECK(root->get_z_index() == 0);
+	CHECK(root->is_in_group("packed"));
+
+	SUBCASE("Instances with groups added at runtime are not pooled") {
+		root->add_to_group("runtime");
+		CHECK_FALSE(scene->recycle(root));
+	}
+
+	SUBCASE("Instances with a changed hierarchy are not pooled") {
+		root->remove_child(child);
+		memdelete(child);
+		CHECK_FALSE(scene->recycle(root));
+	}
+
+	SUBCASE("Instances are not pooled once the pool is full") {
+		Node *other = scene->instance();
+		REQUIRE(scene->recycle(root));
+		CHECK_FALSE(scene->recycle(other));
+		CHECK(scene->instance_pooled() == root);
+		memdelete(root);
+	}
+
+	scene->set_pool_size(0);
+}
+
+} // namespace TestPackedScene
+
+#endif // TEST_PACKED_SCENE_H
@@ -33,6 +33,7 @@
 
 #include "core/io/file_access_pack.h"
 #include "core/io/pck_packer.h"
+#include "core/os/dir_access.h"
 #include "core/os/os.h"
 
 #include "thirdparty/doctest/doctest.h"
@@ -109,6 +110,130 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 35000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+static void _write_test_file(const String &p_path, const Vector<uint8_t> &p_data) {
+	FileAccessRef f = FileAccess::open(p_path, FileAccess::WRITE);
+	REQUIRE(f);
+	f->store_buffer(p_data.ptr(), p_data.size());
+}
+
+TEST_CASE("[PCKPacker] Store identical and unchanged files only once") {
+	const String cache_path = OS::get_singleton()->get_cache_path();
+	const String base_pck_path = cache_path.plus_file("output_base.pck");
+	const String patch_pck_path = cache_path.plus_file("output_patch.pck");
+
+	Vector<uint8_t> data;
+	data.resize(8192);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = i * 7;
+	}
+	_write_test_file(cache_path.plus_file("pck_packer_a.bin"), data);
+	_write_test_file(cache_path.plus_file("pck_packer_b.bin"), data);
+	data.write[0] = 1;
+	_write_test_file(cache_path.plus_file("pck_packer_c.bin"), data);
+
+	PCKPacker pck_packer;
+	REQUIRE(pck_packer.pck_start(base_pck_path, 32, ENCRYPTION_KEY) == OK);
+	CHECK(pck_packer.add_file("res://a.bin", cache_path.plus_file("pck_packer_a.bin")) == OK);
+	CHECK(pck_packer.add_file("res://b.bin", cache_path.plus_file("pck_packer_b.bin")) == OK);
+	CHECK(pck_packer.add_file("res://c.bin", cache_path.plus_file("pck_packer_c.bin")) == OK);
+	CHECK(pck_packer.flush() == OK);
+
+	FileAccessRef base = FileAccess::open(base_pck_path, FileAccess::READ);
+	REQUIRE(base);
+	CHECK_MESSAGE(
+			base->get_length() < 3 * 8192,
+			"Files with identical contents should share their data in the PCK.");
+
+	data.write[1] = 2;
+	_write_test_file(cache_path.plus_file("pck_packer_c.bin"), data);
+
+	REQUIRE(pck_packer.pck_start(patch_pck_path, 32, ENCRYPTION_KEY) == OK);
+	CHECK(pck_packer.set_base_pack(base_pck_path) == OK);
+	CHECK(pck_packer.add_file("res://a.bin", cache_path.plus_file("pck_packer_a.bin")) == OK);
+	CHECK(pck_packer.add_file("res://c.bin", cache_path.plus_file("pck_packer_c.bin")) == OK);
+	CHECK(pck_packer.flush() == OK);
+
+	FileAccessRef patch = FileAccess::open(patch_pck_path, FileAccess::READ);
+	REQUIRE(patch);
+	CHECK_MESSAGE(
+			patch->get_length() >= 8192,
+			"The patch PCK should contain the changed file.");
+	CHECK_MESSAGE(
+			patch->get_length() < 2 * 8192,
+			"The patch PCK shouldn't contain files that are unchanged from the base PCK.");
+}
+
+TEST_CASE("[PCKPacker] Load a patch PCK on top of its base") {
+	PackedData *packed_data = PackedData::get_singleton();
+	REQUIRE(packed_data);
+
+	const String cache_path = OS::get_singleton()->get_cache_path();
+	const String base_pck_path = cache_path.plus_file("output_patch_base.pck");
+	const String patch_pck_path = cache_path.plus_file("output_patch_top.pck");
+	const String source_paths[] = { cache_path.plus_file("pck_patch_a.bin"), cache_path.plus_file("pck_patch_b.bin"), cache_path.plus_file("pck_patch_c.bin") };
+
+	Vector<uint8_t> data_a;
+	data_a.resize(4096);
+	for (int i = 0; i < data_a.size(); i++) {
+		data_a.write[i] = i * 3;
+	}
+	Vector<uint8_t> data_b = data_a;
+	data_b.write[0] = 1;
+	_write_test_file(source_paths[0], data_a);
+	_write_test_file(source_paths[1], data_b);
+
+	PCKPacker pck_packer;
+	REQUIRE(pck_packer.pck_start(base_pck_path, 32, ENCRYPTION_KEY) == OK);
+	CHECK(pck_packer.add_file("res://pck_patch/a.bin", source_paths[0]) == OK);
+	CHECK(pck_packer.add_file("res://pck_patch/b.bin", source_paths[1]) == OK);
+	CHECK(pck_packer.flush() == OK);
+
+	// The patch changes b.bin and adds c.bin in a new directory, a.bin is only in the base.
+	Vector<uint8_t> data_b_patched = data_b;
+	data_b_patched.write[1] = 2;
+	_write_test_file(source_paths[1], data_b_patched);
+	_write_test_file(source_paths[2], data_a);
+
+	REQUIRE(pck_packer.pck_start(patch_pck_path, 32, ENCRYPTION_KEY) == OK);
+	CHECK(pck_packer.set_base_pack(base_pck_path) == OK);
+	CHECK(pck_packer.add_file("res://pck_patch/a.bin", source_paths[0]) == OK);
+	CHECK(pck_packer.add_file("res://pck_patch/b.bin", source_paths[1]) == OK);
+	CHECK(pck_packer.add_file("res://pck_patch/sub/c.bin", source_paths[2]) == OK);
+	CHECK(pck_packer.flush() == OK);
+
+	REQUIRE(packed_data->add_pack(base_pck_path, false, 0) == OK);
+	REQUIRE(packed_data->add_pack(patch_pck_path, true, 0) == OK);
+
+	CHECK_MESSAGE(
+			FileAccess::get_file_as_array("res://pck_patch/a.bin") == data_a,
+			"Files left out of the patch should be read from the base PCK.");
+	CHECK_MESSAGE(
+			FileAccess::get_file_as_array("res://pck_patch/b.bin") == data_b_patched,
+			"Files changed in the patch should replace the ones in the base PCK.");
+	CHECK_MESSAGE(
+			FileAccess::get_file_as_array("res://pck_patch/sub/c.bin") == data_a,
+			"Files added by the patch should be found.");
+
+	CHECK(packed_data->has_path("res://pck_patch/sub/c.bin"));
+	CHECK(!packed_data->has_path("res://pck_patch/c.bin"));
+	CHECK_MESSAGE(
+			packed_data->has_directory("res://pck_patch/sub"),
+			"Directories added by the patch should be found in the path index.");
+	CHECK_MESSAGE(
+			packed_data->has_directory("res://pck_patch/sub/"),
+			"Directory paths should be simplified before looking them up.");
+	CHECK(!packed_data->has_directory("res://pck_patch/missing"));
+	CHECK_MESSAGE(
+			packed_data->has_directory("res://pck_patch/missing/../sub"),
+			"Relative directory paths should still be resolved through the directory tree.");
+
+	for (const String &path : source_paths) {
+		DirAccess::remove_file_or_error(path);
+	}
+	DirAccess::remove_file_or_error(base_pck_path);
+	DirAccess::remove_file_or_error(patch_pck_path);
+}
 } // namespace TestPCKPacker
 
 #endif // TEST_PCK_PACKER_H
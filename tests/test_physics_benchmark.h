@@ -0,0 +1,648 @@
+/*************************************************************************/
+/*  test_physics_benchmark.h                                             */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PHYSICS_BENCHMARK_H
+#define TEST_PHYSICS_BENCHMARK_H
+
+#include "core/math/random_pcg.h"
+#include "core/os/os.h"
+#include "servers/physics_2d/physics_server_2d_sw.h"
+#include "servers/physics_3d/physics_server_3d_sw.h"
+#include "tests/test_macros.h"
+
+// Headless benchmark scenes, driving the physics servers directly.
+// Usage: `godot --test physics-benchmark-3d [--steps <count>] [--scene <name>]`,
+// same for `physics-benchmark-2d`.
+
+namespace TestPhysicsBenchmark {
+
+const int DEFAULT_STEP_COUNT = 600;
+const real_t STEP_TIME = 1.0 / 60.0;
+
+enum Phase {
+	PHASE_INTEGRATE_FORCES,
+	PHASE_GENERATE_ISLANDS,
+	PHASE_SETUP_CONSTRAINTS,
+	PHASE_SOLVE_CONSTRAINTS,
+	PHASE_INTEGRATE_VELOCITIES,
+	PHASE_MAX
+};
+
+static const char *phase_names[PHASE_MAX] = {
+	"integrate_forces",
+	"generate_islands",
+	"setup_constraints",
+	"solve_constraints",
+	"integrate_velocities",
+};
+
+// Times of a scene, in usec and summed over all the steps.
+struct BenchmarkTimes {
+	uint64_t step = 0;
+	uint64_t phases[PHASE_MAX] = {};
+	uint64_t queries = 0;
+};
+
+static String _get_argument(const String &p_name, const String &p_default) {
+	List<String> args = OS::get_singleton()->get_cmdline_args();
+	List<String>::Element *E = args.find(p_name);
+	if (E && E->next()) {
+		return E->next()->get();
+	}
+	return p_default;
+}
+
+static bool _is_scene_selected(const String &p_scene) {
+	String selected = _get_argument("--scene", "");
+	return selected.is_empty() || selected == p_scene;
+}
+
+// Both servers report the time spent in each phase of their last step, with the same info values.
+template <class T>
+static void _add_phase_times(T *p_server, BenchmarkTimes &r_times) {
+	r_times.phases[PHASE_INTEGRATE_FORCES] += p_server->get_process_info(T::INFO_INTEGRATE_FORCES_TIME);
+	r_times.phases[PHASE_GENERATE_ISLANDS] += p_server->get_process_info(T::INFO_GENERATE_ISLANDS_TIME);
+	r_times.phases[PHASE_SETUP_CONSTRAINTS] += p_server->get_process_info(T::INFO_SETUP_CONSTRAINTS_TIME);
+	r_times.phases[PHASE_SOLVE_CONSTRAINTS] += p_server->get_process_info(T::INFO_SOLVE_CONSTRAINTS_TIME);
+	r_times.phases[PHASE_INTEGRATE_VELOCITIES] += p_server->get_process_info(T::INFO_INTEGRATE_VELOCITIES_TIME);
+}
+
+template <class T>
+static void _print_results(T *p_server, const String &p_scene, int p_object_count, int p_step_count, int p_ray_count, const BenchmarkTimes &p_times) {
+	print_line(vformat("%s: %d objects, %d steps, %d msec (%.1f usec/step).", p_scene, p_object_count, p_step_count, p_times.step / 1000, double(p_times.step) / p_step_count));
+
+	uint64_t phases_total = 0;
+	for (int i = 0; i < PHASE_MAX; i++) {
+		print_line(vformat("    %s: %.1f usec/step", phase_names[i], double(p_times.phases[i]) / p_step_count));
+		phases_total += p_times.phases[i];
+	}
+	// Everything the phases don't cover, mostly the broadphase update at the end of the step.
+	uint64_t other = p_times.step > phases_total ? p_times.step - phases_total : 0;
+	print_line(vformat("    broadphase and other: %.1f usec/step", double(other) / p_step_count));
+
+	if (p_ray_count > 0) {
+		print_line(vformat("    %d rays: %.1f usec/step", p_ray_count, double(p_times.queries) / p_step_count));
+	}
+
+	print_line(vformat("    last step: %d active objects, %d collision pairs, %d islands.", p_server->get_process_info(T::INFO_ACTIVE_OBJECTS), p_server->get_process_info(T::INFO_COLLISION_PAIRS), p_server->get_process_info(T::INFO_ISLAND_COUNT)));
+}
+
+class PhysicsBenchmark3D {
+	PhysicsServer3D *ps = nullptr;
+	RID space;
+	Vector<RID> rids;
+	int object_count = 0;
+
+	RID box_shape;
+	RID sphere_shape;
+	RID capsule_shape;
+
+	Vector<Vector3> ray_from;
+	Vector<Vector3> ray_to;
+
+	RID _create_shape(RID p_shape, const Variant &p_data) {
+		ps->shape_set_data(p_shape, p_data);
+		rids.push_back(p_shape);
+		return p_shape;
+	}
+
+	RID _create_body(RID p_shape, const Transform &p_transform, PhysicsServer3D::BodyMode p_mode = PhysicsServer3D::BODY_MODE_RIGID) {
+		RID body = ps->body_create();
+		ps->body_set_mode(body, p_mode);
+		ps->body_add_shape(body, p_shape);
+		ps->body_set_space(body, space);
+		ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, p_transform);
+		rids.push_back(body);
+		object_count++;
+		return body;
+	}
+
+	void _create_ground() {
+		RID ground_shape = _create_shape(ps->box_shape_create(), Vector3(200, 1, 200));
+		_create_body(ground_shape, Transform(Basis(), Vector3(0, -1, 0)), PhysicsServer3D::BODY_MODE_STATIC);
+	}
+
+	void _create_cone_twist(RID p_body_a, const Vector3 &p_origin_a, RID p_body_b, const Vector3 &p_origin_b, const Vector3 &p_pivot) {
+		RID joint = ps->joint_create();
+		ps->joint_make_cone_twist(joint, p_body_a, Transform(Basis(), p_pivot - p_origin_a), p_body_b, Transform(Basis(), p_pivot - p_origin_b));
+		ps->joint_disable_collisions_between_bodies(joint, true);
+		rids.push_back(joint);
+	}
+
+	void _setup_box_stacks() {
+		_create_ground();
+		for (int stack = 0; stack < 16; stack++) {
+			Vector3 base = Vector3((stack % 4) * 3.0 - 4.5, 0.5, (stack / 4) * 3.0 - 4.5);
+			for (int i = 0; i < 16; i++) {
+				_create_body(box_shape, Transform(Basis(), base + Vector3(0, i * 1.001, 0)));
+			}
+		}
+	}
+
+	void _setup_pyramid() {
+		_create_ground();
+		const int base_size = 30;
+		for (int row = 0; row < base_size; row++) {
+			for (int i = 0; i < base_size - row; i++) {
+				real_t x = (i - (base_size - row - 1) * 0.5) * 1.01;
+				_create_body(box_shape, Transform(Basis(), Vector3(x, 0.5 + row * 1.001, 0)));
+			}
+		}
+	}
+
+	void _setup_spheres_in_bowl() {
+		// Half sphere made of triangles, opened upwards.
+		const real_t radius = 12.0;
+		const int rings = 16;
+		const int segments = 32;
+		Vector<Vector3> faces;
+		for (int ring = 0; ring < rings; ring++) {
+			real_t angle_a = Math_PI * 0.5 * ring / rings;
+			real_t angle_b = Math_PI * 0.5 * (ring + 1) / rings;
+			for (int segment = 0; segment < segments; segment++) {
+				real_t turn_a = Math_TAU * segment / segments;
+				real_t turn_b = Math_TAU * (segment + 1) / segments;
+				Vector3 v[4] = {
+					Vector3(Math::sin(angle_a) * Math::cos(turn_a), -Math::cos(angle_a), Math::sin(angle_a) * Math::sin(turn_a)) * radius,
+					Vector3(Math::sin(angle_a) * Math::cos(turn_b), -Math::cos(angle_a), Math::sin(angle_a) * Math::sin(turn_b)) * radius,
+					Vector3(Math::sin(angle_b) * Math::cos(turn_b), -Math::cos(angle_b), Math::sin(angle_b) * Math::sin(turn_b)) * radius,
+					Vector3(Math::sin(angle_b) * Math::cos(turn_a), -Math::cos(angle_b), Math::sin(angle_b) * Math::sin(turn_a)) * radius,
+				};
+				faces.push_back(v[0]);
+				faces.push_back(v[1]);
+				faces.push_back(v[2]);
+				faces.push_back(v[0]);
+				faces.push_back(v[2]);
+				faces.push_back(v[3]);
+			}
+		}
+
+		Dictionary data;
+		data["faces"] = faces;
+		data["backface_collision"] = true;
+		RID bowl_shape = _create_shape(ps->concave_polygon_shape_create(), data);
+		_create_body(bowl_shape, Transform(Basis(), Vector3(0, radius, 0)), PhysicsServer3D::BODY_MODE_STATIC);
+
+		for (int i = 0; i < 1000; i++) {
+			Vector3 position = Vector3((i % 10) - 4.5, 4.0 + (i / 100) * 1.1, ((i / 10) % 10) - 4.5);
+			// Shift each layer a little, so the spheres don't land exactly on top of each other.
+			position += Vector3(0.1, 0, 0.1) * ((i / 100) % 3);
+			_create_body(sphere_shape, Transform(Basis(), position));
+		}
+	}
+
+	void _setup_ragdolls() {
+		_create_ground();
+		RID pelvis_shape = _create_shape(ps->box_shape_create(), Vector3(0.3, 0.15, 0.15));
+		RID chest_shape = _create_shape(ps->box_shape_create(), Vector3(0.35, 0.25, 0.15));
+		RID head_shape = _create_shape(ps->sphere_shape_create(), 0.15);
+
+		for (int i = 0; i < 64; i++) {
+			Vector3 offset = Vector3((i % 8) * 2.0 - 7.0, 1.0 + (i / 8) * 0.5, (i / 8) * 2.0 - 7.0);
+
+			Vector3 pelvis_origin = offset + Vector3(0, 1.0, 0);
+			Vector3 chest_origin = offset + Vector3(0, 1.45, 0);
+			Vector3 head_origin = offset + Vector3(0, 1.9, 0);
+			RID pelvis = _create_body(pelvis_shape, Transform(Basis(), pelvis_origin));
+			RID chest = _create_body(chest_shape, Transform(Basis(), chest_origin));
+			RID head = _create_body(head_shape, Transform(Basis(), head_origin));
+			_create_cone_twist(pelvis, pelvis_origin, chest, chest_origin, offset + Vector3(0, 1.18, 0));
+			_create_cone_twist(chest, chest_origin, head, head_origin, offset + Vector3(0, 1.72, 0));
+
+			for (int side = -1; side <= 1; side += 2) {
+				Vector3 arm_origin = offset + Vector3(side * 0.5, 1.35, 0);
+				Vector3 leg_origin = offset + Vector3(side * 0.15, 0.45, 0);
+				RID arm = _create_body(capsule_shape, Transform(Basis(), arm_origin));
+				RID leg = _create_body(capsule_shape, Transform(Basis(), leg_origin));
+				_create_cone_twist(chest, chest_origin, arm, arm_origin, offset + Vector3(side * 0.4, 1.65, 0));
+				_create_cone_twist(pelvis, pelvis_origin, leg, leg_origin, offset + Vector3(side * 0.15, 0.85, 0));
+			}
+		}
+	}
+
+	void _setup_trimesh_ground() {
+		// Rolling hills of 128x128 quads.
+		const int size = 128;
+		const real_t cell_size = 2.0;
+		Vector<Vector3> faces;
+		faces.resize(size * size * 6);
+		Vector3 *faces_ptrw = faces.ptrw();
+		for (int z = 0; z < size; z++) {
+			for (int x = 0; x < size; x++) {
+				Vector3 v[4];
+				for (int i = 0; i < 4; i++) {
+					int vx = x + (i == 1 || i == 2 ? 1 : 0);
+					int vz = z + (i >= 2 ? 1 : 0);
+					real_t height = Math::sin(vx * 0.2) * 2.0 + Math::cos(vz * 0.15) * 1.5;
+					v[i] = Vector3((vx - size * 0.5) * cell_size, height, (vz - size * 0.5) * cell_size);
+				}
+				Vector3 *face = &faces_ptrw[(z * size + x) * 6];
+				face[0] = v[0];
+				face[1] = v[1];
+				face[2] = v[2];
+				face[3] = v[0];
+				face[4] = v[2];
+				face[5] = v[3];
+			}
+		}
+
+		Dictionary data;
+		data["faces"] = faces;
+		data["backface_collision"] = false;
+		RID ground_shape = _create_shape(ps->concave_polygon_shape_create(), data);
+		_create_body(ground_shape, Transform(), PhysicsServer3D::BODY_MODE_STATIC);
+
+		RandomPCG rng(1234);
+		RID shapes[3] = { box_shape, sphere_shape, capsule_shape };
+		for (int i = 0; i < 800; i++) {
+			Vector3 position = Vector3(rng.random(-100.0, 100.0), rng.random(6.0, 20.0), rng.random(-100.0, 100.0));
+			_create_body(shapes[i % 3], Transform(Basis(), position));
+		}
+	}
+
+	void _setup_areas() {
+		_create_ground();
+		RID area_shape = _create_shape(ps->box_shape_create(), Vector3(1, 1, 1));
+		for (int i = 0; i < 400; i++) {
+			RID area = ps->area_create();
+			ps->area_add_shape(area, area_shape);
+			ps->area_set_space(area, space);
+			ps->area_set_transform(area, Transform(Basis(), Vector3((i % 10) * 2.0 - 9.0, 1.0 + (i / 100) * 2.0, ((i / 10) % 10) * 2.0 - 9.0)));
+			ps->area_set_space_override_mode(area, PhysicsServer3D::AREA_SPACE_OVERRIDE_COMBINE);
+			ps->area_set_param(area, PhysicsServer3D::AREA_PARAM_LINEAR_DAMP, 0.5);
+			rids.push_back(area);
+			object_count++;
+		}
+
+		for (int i = 0; i < 400; i++) {
+			Vector3 position = Vector3((i % 20) - 9.5, 12.0 + (i / 20) * 1.1, ((i * 7) % 20) - 9.5);
+			_create_body(sphere_shape, Transform(Basis(), position));
+		}
+	}
+
+	void _setup_raycast_storm() {
+		_setup_box_stacks();
+
+		RandomPCG rng(1234);
+		const int ray_count = 10000;
+		ray_from.resize(ray_count);
+		ray_to.resize(ray_count);
+		for (int i = 0; i < ray_count; i++) {
+			Vector3 from = Vector3(rng.random(-8.0, 8.0), rng.random(0.0, 20.0), rng.random(-8.0, 8.0));
+			ray_from.write[i] = from;
+			if (i % 2) {
+				// Ground checks.
+				ray_to.write[i] = from - Vector3(0, 25, 0);
+			} else {
+				// Line of sight checks across the scene.
+				ray_to.write[i] = Vector3(rng.random(-8.0, 8.0), rng.random(0.0, 20.0), rng.random(-8.0, 8.0));
+			}
+		}
+	}
+
+	void _run(const String &p_scene, void (PhysicsBenchmark3D::*p_setup)(), int p_step_count) {
+		if (!_is_scene_selected(p_scene)) {
+			return;
+		}
+
+		space = ps->space_create();
+		ps->space_set_active(space, true);
+		ps->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY, 9.8);
+		ps->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY_VECTOR, Vector3(0, -1, 0));
+		box_shape = _create_shape(ps->box_shape_create(), Vector3(0.5, 0.5, 0.5));
+		sphere_shape = _create_shape(ps->sphere_shape_create(), 0.4);
+		Dictionary capsule_data;
+		capsule_data["radius"] = 0.1;
+		capsule_data["height"] = 0.4;
+		capsule_shape = _create_shape(ps->capsule_shape_create(), capsule_data);
+
+		(this->*p_setup)();
+
+		BenchmarkTimes times;
+		Vector<PhysicsDirectSpaceState3D::RayResult> ray_results;
+		ray_results.resize(ray_from.size());
+		for (int i = 0; i < p_step_count; i++) {
+			uint64_t begin_time = OS::get_singleton()->get_ticks_usec();
+			ps->step(STEP_TIME);
+			times.step += OS::get_singleton()->get_ticks_usec() - begin_time;
+			_add_phase_times(ps, times);
+
+			if (ray_from.size()) {
+				begin_time = OS::get_singleton()->get_ticks_usec();
+				ps->space_get_direct_state(space)->intersect_rays(ray_from.ptr(), ray_to.ptr(), ray_from.size(), ray_results.ptrw());
+				times.queries += OS::get_singleton()->get_ticks_usec() - begin_time;
+			}
+		}
+
+		_print_results(ps, p_scene, object_count, p_step_count, ray_from.size(), times);
+
+		// Joints and bodies are freed before the shapes they use.
+		for (int i = rids.size() - 1; i >= 0; i--) {
+			ps->free(rids[i]);
+		}
+		ps->free(space);
+		rids.clear();
+		object_count = 0;
+		ray_from.clear();
+		ray_to.clear();
+	}
+
+public:
+	void run(int p_step_count) {
+		_run("box_stacks", &PhysicsBenchmark3D::_setup_box_stacks, p_step_count);
+		_run("pyramid", &PhysicsBenchmark3D::_setup_pyramid, p_step_count);
+		_run("spheres_in_bowl", &PhysicsBenchmark3D::_setup_spheres_in_bowl, p_step_count);
+		_run("ragdolls", &PhysicsBenchmark3D::_setup_ragdolls, p_step_count);
+		_run("trimesh_ground", &PhysicsBenchmark3D::_setup_trimesh_ground, p_step_count);
+		_run("areas", &PhysicsBenchmark3D::_setup_areas, p_step_count);
+		_run("raycast_storm", &PhysicsBenchmark3D::_setup_raycast_storm, p_step_count);
+	}
+
+	PhysicsBenchmark3D(PhysicsServer3D *p_server) {
+		ps = p_server;
+	}
+};
+
+class PhysicsBenchmark2D {
+	PhysicsServer2D *ps = nullptr;
+	RID space;
+	Vector<RID> rids;
+	int object_count = 0;
+
+	RID box_shape;
+	RID circle_shape;
+	RID capsule_shape;
+
+	Vector<Vector2> ray_from;
+	Vector<Vector2> ray_to;
+
+	RID _create_shape(RID p_shape, const Variant &p_data) {
+		ps->shape_set_data(p_shape, p_data);
+		rids.push_back(p_shape);
+		return p_shape;
+	}
+
+	RID _create_body(RID p_shape, const Vector2 &p_position, PhysicsServer2D::BodyMode p_mode = PhysicsServer2D::BODY_MODE_RIGID) {
+		RID body = ps->body_create();
+		ps->body_set_mode(body, p_mode);
+		ps->body_add_shape(body, p_shape);
+		ps->body_set_space(body, space);
+		ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, p_position));
+		rids.push_back(body);
+		object_count++;
+		return body;
+	}
+
+	void _create_ground() {
+		RID ground_shape = _create_shape(ps->rectangle_shape_create(), Vector2(4000, 20));
+		_create_body(ground_shape, Vector2(0, 20), PhysicsServer2D::BODY_MODE_STATIC);
+	}
+
+	void _create_pin(RID p_body_a, RID p_body_b, const Vector2 &p_anchor) {
+		RID joint = ps->joint_create();
+		ps->joint_make_pin(joint, p_anchor, p_body_a, p_body_b);
+		ps->joint_disable_collisions_between_bodies(joint, true);
+		rids.push_back(joint);
+	}
+
+	void _setup_box_stacks() {
+		_create_ground();
+		for (int stack = 0; stack < 24; stack++) {
+			for (int i = 0; i < 20; i++) {
+				_create_body(box_shape, Vector2((stack - 11.5) * 60.0, -10.0 - i * 20.02));
+			}
+		}
+	}
+
+	void _setup_pyramid() {
+		_create_ground();
+		const int base_size = 40;
+		for (int row = 0; row < base_size; row++) {
+			for (int i = 0; i < base_size - row; i++) {
+				real_t x = (i - (base_size - row - 1) * 0.5) * 20.2;
+				_create_body(box_shape, Vector2(x, -10.0 - row * 20.02));
+			}
+		}
+	}
+
+	void _setup_circles_in_bowl() {
+		// Half circle made of segments, opened upwards.
+		const real_t radius = 400.0;
+		const int segments = 64;
+		Vector<Vector2> points;
+		for (int i = 0; i < segments; i++) {
+			real_t angle_a = Math_PI * i / segments;
+			real_t angle_b = Math_PI * (i + 1) / segments;
+			points.push_back(Vector2(Math::cos(angle_a), Math::sin(angle_a)) * radius);
+			points.push_back(Vector2(Math::cos(angle_b), Math::sin(angle_b)) * radius);
+		}
+		RID bowl_shape = _create_shape(ps->concave_polygon_shape_create(), points);
+		_create_body(bowl_shape, Vector2(0, -radius), PhysicsServer2D::BODY_MODE_STATIC);
+
+		for (int i = 0; i < 1000; i++) {
+			Vector2 position = Vector2((i % 40) * 14.0 - 273.0, -250.0 - (i / 40) * 14.0);
+			// Shift each row a little, so the circles don't land exactly on top of each other.
+			position.x += ((i / 40) % 3) * 2.0;
+			_create_body(circle_shape, position);
+		}
+	}
+
+	void _setup_ragdolls() {
+		_create_ground();
+		RID torso_shape = _create_shape(ps->rectangle_shape_create(), Vector2(10, 20));
+		RID head_shape = _create_shape(ps->circle_shape_create(), 8.0);
+
+		for (int i = 0; i < 100; i++) {
+			Vector2 offset = Vector2((i % 20) * 60.0 - 570.0, -(i / 20) * 120.0);
+
+			RID torso = _create_body(torso_shape, offset + Vector2(0, -70));
+			RID head = _create_body(head_shape, offset + Vector2(0, -98));
+			_create_pin(torso, head, offset + Vector2(0, -90));
+
+			for (int side = -1; side <= 1; side += 2) {
+				RID arm = _create_body(capsule_shape, offset + Vector2(side * 16.0, -70));
+				RID leg = _create_body(capsule_shape, offset + Vector2(side * 6.0, -30));
+				_create_pin(torso, arm, offset + Vector2(side * 14.0, -86));
+				_create_pin(torso, leg, offset + Vector2(side * 6.0, -50));
+			}
+		}
+	}
+
+	void _setup_segment_ground() {
+		// Rolling hills of 4096 segments.
+		const int segments = 4096;
+		const real_t segment_length = 10.0;
+		Vector<Vector2> points;
+		points.resize(segments * 2);
+		Vector2 *points_ptrw = points.ptrw();
+		for (int i = 0; i < segments; i++) {
+			for (int j = 0; j < 2; j++) {
+				real_t x = (i + j - segments * 0.5) * segment_length;
+				points_ptrw[i * 2 + j] = Vector2(x, Math::sin(x * 0.01) * 40.0);
+			}
+		}
+		RID ground_shape = _create_shape(ps->concave_polygon_shape_create(), points);
+		_create_body(ground_shape, Vector2(), PhysicsServer2D::BODY_MODE_STATIC);
+
+		RandomPCG rng(1234);
+		RID shapes[3] = { box_shape, circle_shape, capsule_shape };
+		for (int i = 0; i < 1000; i++) {
+			Vector2 position = Vector2(rng.random(-20000.0, 20000.0), rng.random(-400.0, -100.0));
+			_create_body(shapes[i % 3], position);
+		}
+	}
+
+	void _setup_areas() {
+		_create_ground();
+		RID area_shape = _create_shape(ps->rectangle_shape_create(), Vector2(20, 20));
+		for (int i = 0; i < 400; i++) {
+			RID area = ps->area_create();
+			ps->area_add_shape(area, area_shape);
+			ps->area_set_space(area, space);
+			ps->area_set_transform(area, Transform2D(0, Vector2((i % 40) * 40.0 - 780.0, -20.0 - (i / 40) * 40.0)));
+			ps->area_set_space_override_mode(area, PhysicsServer2D::AREA_SPACE_OVERRIDE_COMBINE);
+			ps->area_set_param(area, PhysicsServer2D::AREA_PARAM_LINEAR_DAMP, 0.5);
+			rids.push_back(area);
+			object_count++;
+		}
+
+		for (int i = 0; i < 400; i++) {
+			Vector2 position = Vector2((i % 40) * 40.0 - 785.0, -500.0 - (i / 40) * 14.0);
+			_create_body(circle_shape, position);
+		}
+	}
+
+	void _setup_raycast_storm() {
+		_setup_box_stacks();
+
+		RandomPCG rng(1234);
+		const int ray_count = 10000;
+		ray_from.resize(ray_count);
+		ray_to.resize(ray_count);
+		for (int i = 0; i < ray_count; i++) {
+			Vector2 from = Vector2(rng.random(-720.0, 720.0), rng.random(-450.0, 0.0));
+			ray_from.write[i] = from;
+			if (i % 2) {
+				// Ground checks.
+				ray_to.write[i] = from + Vector2(0, 500);
+			} else {
+				// Line of sight checks across the scene.
+				ray_to.write[i] = Vector2(rng.random(-720.0, 720.0), rng.random(-450.0, 0.0));
+			}
+		}
+	}
+
+	void _run(const String &p_scene, void (PhysicsBenchmark2D::*p_setup)(), int p_step_count) {
+		if (!_is_scene_selected(p_scene)) {
+			return;
+		}
+
+		space = ps->space_create();
+		ps->space_set_active(space, true);
+		ps->area_set_param(space, PhysicsServer2D::AREA_PARAM_GRAVITY, 98.0);
+		ps->area_set_param(space, PhysicsServer2D::AREA_PARAM_GRAVITY_VECTOR, Vector2(0, 1));
+		box_shape = _create_shape(ps->rectangle_shape_create(), Vector2(10, 10));
+		circle_shape = _create_shape(ps->circle_shape_create(), 6.0);
+		capsule_shape = _create_shape(ps->capsule_shape_create(), Vector2(4, 16));
+
+		(this->*p_setup)();
+
+		BenchmarkTimes times;
+		Vector<PhysicsDirectSpaceState2D::RayResult> ray_results;
+		ray_results.resize(ray_from.size());
+		for (int i = 0; i < p_step_count; i++) {
+			uint64_t begin_time = OS::get_singleton()->get_ticks_usec();
+			ps->step(STEP_TIME);
+			times.step += OS::get_singleton()->get_ticks_usec() - begin_time;
+			_add_phase_times(ps, times);
+
+			if (ray_from.size()) {
+				begin_time = OS::get_singleton()->get_ticks_usec();
+				ps->space_get_direct_state(space)->intersect_rays(ray_from.ptr(), ray_to.ptr(), ray_from.size(), ray_results.ptrw());
+				times.queries += OS::get_singleton()->get_ticks_usec() - begin_time;
+			}
+		}
+
+		_print_results(ps, p_scene, object_count, p_step_count, ray_from.size(), times);
+
+		// Joints and bodies are freed before the shapes they use.
+		for (int i = rids.size() - 1; i >= 0; i--) {
+			ps->free(rids[i]);
+		}
+		ps->free(space);
+		rids.clear();
+		object_count = 0;
+		ray_from.clear();
+		ray_to.clear();
+	}
+
+public:
+	void run(int p_step_count) {
+		_run("box_stacks", &PhysicsBenchmark2D::_setup_box_stacks, p_step_count);
+		_run("pyramid", &PhysicsBenchmark2D::_setup_pyramid, p_step_count);
+		_run("circles_in_bowl", &PhysicsBenchmark2D::_setup_circles_in_bowl, p_step_count);
+		_run("ragdolls", &PhysicsBenchmark2D::_setup_ragdolls, p_step_count);
+		_run("segment_ground", &PhysicsBenchmark2D::_setup_segment_ground, p_step_count);
+		_run("areas", &PhysicsBenchmark2D::_setup_areas, p_step_count);
+		_run("raycast_storm", &PhysicsBenchmark2D::_setup_raycast_storm, p_step_count);
+	}
+
+	PhysicsBenchmark2D(PhysicsServer2D *p_server) {
+		ps = p_server;
+	}
+};
+
+static int _get_step_count() {
+	return MAX(_get_argument("--steps", itos(DEFAULT_STEP_COUNT)).to_int(), 1);
+}
+
+static void benchmark_physics_3d() {
+	// Physics servers aren't set up for tests, use the default one directly.
+	PhysicsServer3DSW *server = memnew(PhysicsServer3DSW);
+	server->init();
+	PhysicsBenchmark3D(server).run(_get_step_count());
+	server->finish();
+	memdelete(server);
+}
+
+static void benchmark_physics_2d() {
+	PhysicsServer2DSW *server = memnew(PhysicsServer2DSW);
+	server->init();
+	PhysicsBenchmark2D(server).run(_get_step_count());
+	server->finish();
+	memdelete(server);
+}
+
+REGISTER_TEST_COMMAND("physics-benchmark-3d", &benchmark_physics_3d);
+REGISTER_TEST_COMMAND("physics-benchmark-2d", &benchmark_physics_2d);
+
+} // namespace TestPhysicsBenchmark
+
+#endif // TEST_PHYSICS_BENCHMARK_H
@@ -0,0 +1,593 @@
+/*************************************************************************/
+/*  test_physics_server.h                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PHYSICS_SERVER_H
+#define TEST_PHYSICS_SERVER_H
+
+#include "core/math/random_pcg.h"
+#include "servers/physics_2d/physics_server_2d_sw.h"
+#include "servers/physics_3d/collision_solver_3d_sw.h"
+#include "servers/physics_3d/physics_server_3d_sw.h"
+#include "servers/physics_3d/shape_3d_sw.h"
+#include "tests/test_macros.h"
+
+namespace TestPhysicsServer {
+
+const real_t STEP_TIME = 1.0 / 60.0;
+
+// More rays than needed for batches to be split over several threads.
+const int RAY_COUNT = 512;
+
+TEST_CASE("[PhysicsServer3D] Batched rays hit the same as single rays") {
+	PhysicsServer3DSW *ps = memnew(PhysicsServer3DSW);
+	ps->init();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+	RID sphere_shape = ps->sphere_shape_create();
+	ps->shape_set_data(sphere_shape, 0.5);
+
+	RandomPCG rng(1234);
+	Vector<RID> bodies;
+	for (int i = 0; i < 64; i++) {
+		RID body = ps->body_create();
+		ps->body_set_mode(body, PhysicsServer3D::BODY_MODE_STATIC);
+		ps->body_add_shape(body, i % 2 ? sphere_shape : box_shape);
+		ps->body_set_space(body, space);
+		Basis basis = Basis(Vector3(rng.random(-1.0, 1.0), 1.0, rng.random(-1.0, 1.0)).normalized(), rng.random(0.0, Math_TAU));
+		ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform(basis, Vector3(rng.random(-8.0, 8.0), rng.random(-8.0, 8.0), rng.random(-8.0, 8.0))));
+		bodies.push_back(body);
+	}
+	ps->step(STEP_TIME);
+
+	Vector<Vector3> ray_from;
+	Vector<Vector3> ray_to;
+	for (int i = 0; i < RAY_COUNT; i++) {
+		ray_from.push_back(Vector3(rng.random(-10.0, 10.0), rng.random(-10.0, 10.0), rng.random(-10.0, 10.0)));
+		ray_to.push_back(Vector3(rng.random(-10.0, 10.0), rng.random(-10.0, 10.0), rng.random(-10.0, 10.0)));
+	}
+
+	PhysicsDirectSpaceState3D *state = ps->space_get_direct_state(space);
+	Vector<PhysicsDirectSpaceState3D::RayResult> results;
+	results.resize(RAY_COUNT);
+	int hit_count = state->intersect_rays(ray_from.ptr(), ray_to.ptr(), RAY_COUNT, results.ptrw());
+
+	int single_hit_count = 0;
+	for (int i = 0; i < RAY_COUNT; i++) {
+		PhysicsDirectSpaceState3D::RayResult single;
+		bool hit = state->intersect_ray(ray_from[i], ray_to[i], single);
+		const PhysicsDirectSpaceState3D::RayResult &batched = results[i];
+		CHECK_MESSAGE(hit == batched.rid.is_valid(), vformat("Ray %d should hit the same in both queries.", i));
+		if (!hit || !batched.rid.is_valid()) {
+			continue;
+		}
+
+		single_hit_count++;
+		CHECK(batched.rid == single.rid);
+		CHECK(batched.shape == single.shape);
+		CHECK(batched.position.is_equal_approx(single.position));
+		CHECK(batched.normal.is_equal_approx(single.normal));
+	}
+	CHECK(single_hit_count > 0);
+	CHECK(hit_count == single_hit_count);
+
+	for (int i = 0; i < bodies.size(); i++) {
+		ps->free(bodies[i]);
+	}
+	ps->free(box_shape);
+	ps->free(sphere_shape);
+	ps->free(space);
+	ps->finish();
+	memdelete(ps);
+}
+
+TEST_CASE("[PhysicsServer2D] Batched rays hit the same as single rays") {
+	PhysicsServer2DSW *ps = memnew(PhysicsServer2DSW);
+	ps->init();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	RID rectangle_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(rectangle_shape, Vector2(10, 10));
+	RID circle_shape = ps->circle_shape_create();
+	ps->shape_set_data(circle_shape, 10);
+
+	RandomPCG rng(1234);
+	Vector<RID> bodies;
+	for (int i = 0; i < 64; i++) {
+		RID body = ps->body_create();
+		ps->body_set_mode(body, PhysicsServer2D::BODY_MODE_STATIC);
+		ps->body_add_shape(body, i % 2 ? circle_shape : rectangle_shape);
+		ps->body_set_space(body, space);
+		ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(rng.random(0.0, Math_TAU), Vector2(rng.random(-160.0, 160.0), rng.random(-160.0, 160.0))));
+		bodies.push_back(body);
+	}
+	ps->step(STEP_TIME);
+
+	Vector<Vector2> ray_from;
+	Vector<Vector2> ray_to;
+	for (int i = 0; i < RAY_COUNT; i++) {
+		ray_from.push_back(Vector2(rng.random(-200.0, 200.0), rng.random(-200.0, 200.0)));
+		ray_to.push_back(Vector2(rng.random(-200.0, 200.0), rng.random(-200.0, 200.0)));
+	}
+
+	PhysicsDirectSpaceState2D *state = ps->space_get_direct_state(space);
+	Vector<PhysicsDirectSpaceState2D::RayResult> results;
+	results.resize(RAY_COUNT);
+	int hit_count = state->intersect_rays(ray_from.ptr(), ray_to.ptr(), RAY_COUNT, results.ptrw());
+
+	int single_hit_count = 0;
+	for (int i = 0; i < RAY_COUNT; i++) {
+		PhysicsDirectSpaceState2D::RayResult single;
+		bool hit = state->intersect_ray(ray_from[i], ray_to[i], single);
+		const PhysicsDirectSpaceState2D::RayResult &batched = results[i];
+		CHECK_MESSAGE(hit == batched.rid.is_valid(), vformat("Ray %d should hit the same in both queries.", i));
+		if (!hit || !batched.rid.is_valid()) {
+			continue;
+		}
+
+		single_hit_count++;
+		CHECK(batched.rid == single.rid);
+		CHECK(batched.shape == single.shape);
+		CHECK(batched.position.is_equal_approx(single.position));
+		CHECK(batched.normal.is_equal_approx(single.normal));
+	}
+	CHECK(single_hit_count > 0);
+	CHECK(hit_count == single_hit_count);
+
+	for (int i = 0; i < bodies.size(); i++) {
+		ps->free(bodies[i]);
+	}
+	ps->free(rectangle_shape);
+	ps->free(circle_shape);
+	ps->free(space);
+	ps->finish();
+	memdelete(ps);
+}
+
+struct ContactCollector3D {
+	Vector<Vector3> points;
+	Vector<int> features;
+
+	static void add_contact(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, void *p_userdata) {
+		ContactCollector3D *collector = (ContactCollector3D *)p_userdata;
+		collector->points.push_back(p_point_A);
+		collector->features.push_back(p_index_A);
+	}
+};
+
+TEST_CASE("[PhysicsServer3D] Face contacts keep their feature ids while sliding") {
+	BoxShape3DSW box;
+	box.set_data(Vector3(1, 1, 1));
+
+	// A box turned by 45 degrees on top of another, their faces overlap in an octagon.
+	Transform xform_A = Transform(Basis(Vector3(0, 1, 0), Math_PI / 4.0), Vector3(0, 1.99, 0));
+	Transform xform_B;
+
+	ContactCollector3D before;
+	CHECK(CollisionSolver3DSW::solve_static(&box, xform_A, &box, xform_B, ContactCollector3D::add_contact, &before));
+	CHECK(before.points.size() == 8);
+
+	for (int i = 0; i < before.features.size(); i++) {
+		CHECK_MESSAGE(before.features[i] > 0, "Face contacts should have a feature id.");
+		for (int j = 0; j < i; j++) {
+			CHECK_MESSAGE(before.features[i] != before.features[j], "Contacts of the same manifold should have different feature ids.");
+		}
+	}
+
+	const Vector3 slide = Vector3(0.05, 0, 0.03);
+	xform_A.origin += slide;
+
+	ContactCollector3D after;
+	CHECK(CollisionSolver3DSW::solve_static(&box, xform_A, &box, xform_B, ContactCollector3D::add_contact, &after));
+	CHECK(after.points.size() == before.points.size());
+
+	for (int i = 0; i < after.features.size(); i++) {
+		int previous = before.features.find(after.features[i]);
+		CHECK_MESSAGE(previous != -1, "Sliding a little should keep the feature ids.");
+		if (previous != -1) {
+			CHECK_MESSAGE(after.points[i].distance_to(before.points[previous]) < slide.length() * 2.0, "Contacts with the same feature id should come from the same place.");
+		}
+	}
+}
+
+TEST_CASE("[PhysicsServer3D] Full contact manifolds keep a stable support") {
+	PhysicsServer3DSW *ps = memnew(PhysicsServer3DSW);
+	ps->init();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	ps->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY, 9.8);
+	ps->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY_VECTOR, Vector3(0, -1, 0));
+
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(1, 1, 1));
+
+	RID floor = ps->body_create();
+	ps->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	ps->body_add_shape(floor, box_shape);
+	ps->body_set_space(floor, space);
+
+	// Turned by 45 degrees, the faces touch in an octagon, more points than a manifold holds.
+	RID body = ps->body_create();
+	ps->body_add_shape(body, box_shape);
+	ps->body_set_space(body, space);
+	ps->body_set_max_contacts_reported(body, 8);
+	ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform(Basis(Vector3(0, 1, 0), Math_PI / 4.0), Vector3(0, 2.0, 0)));
+
+	for (int i = 0; i < 120; i++) {
+		ps->step(STEP_TIME);
+	}
+
+	Transform xform = ps->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM);
+	CHECK_MESSAGE(xform.basis.get_axis(1).normalized().dot(Vector3(0, 1, 0)) > 0.999, "The box should rest flat on the floor.");
+	CHECK(Math::abs(xform.origin.y - 2.0) < 0.05);
+
+	PhysicsDirectBodyState3D *state = ps->body_get_direct_state(body);
+	CHECK(state->get_contact_count() == 4);
+
+	// The kept contacts should surround the center of the box, not gather on one side.
+	Vector3 center;
+	for (int i = 0; i < state->get_contact_count(); i++) {
+		center += state->get_contact_local_position(i);
+	}
+	center /= state->get_contact_count();
+	CHECK(Vector2(center.x - xform.origin.x, center.z - xform.origin.z).length() < 0.5);
+
+	ps->free(body);
+	ps->free(floor);
+	ps->free(box_shape);
+	ps->free(space);
+	ps->finish();
+	memdelete(ps);
+}
+
+TEST_CASE("[PhysicsServer3D] Continuous collision detection keeps the velocity of bodies moving away") {
+	PhysicsServer3DSW *ps = memnew(PhysicsServer3DSW);
+	ps->init();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	ps->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY, 0.0);
+
+	RID floor_shape = ps->box_shape_create();
+	ps->shape_set_data(floor_shape, Vector3(10, 1, 10));
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	RID floor = ps->body_create();
+	ps->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	ps->body_add_shape(floor, floor_shape);
+	ps->body_set_space(floor, space);
+
+	// Almost touching the floor, and leaving it fast enough for a cast to be attempted.
+	RID body = ps->body_create();
+	ps->body_add_shape(body, box_shape);
+	ps->body_set_space(body, space);
+	ps->body_set_enable_continuous_collision_detection(body, true);
+	ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform(Basis(), Vector3(0, 1.501, 0)));
+	ps->body_set_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(0, 30, 0));
+
+	ps->step(STEP_TIME);
+
+	Vector3 velocity = ps->body_get_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY);
+	CHECK(velocity.is_equal_approx(Vector3(0, 30, 0)));
+	Transform xform = ps->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM);
+	CHECK(xform.origin.y > 1.9);
+
+	ps->free(body);
+	ps->free(floor);
+	ps->free(box_shape);
+	ps->free(floor_shape);
+	ps->free(space);
+	ps->finish();
+	memdelete(ps);
+}
+
+TEST_CASE("[PhysicsServer3D] Continuous collision detection stops fast bodies before thin walls") {
+	PhysicsServer3DSW *ps = memnew(PhysicsServer3DSW);
+	ps->init();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	ps->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY, 0.0);
+
+	RID wall_shape = ps->box_shape_create();
+	ps->shape_set_data(wall_shape, Vector3(0.05, 0.2, 2));
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	// Only in the way of the lower half of the box, a ray cast from a corner of the box would miss it.
+	RID wall = ps->body_create();
+	ps->body_set_mode(wall, PhysicsServer3D::BODY_MODE_STATIC);
+	ps->body_add_shape(wall, wall_shape);
+	ps->body_set_space(wall, space);
+	ps->body_set_state(wall, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform(Basis(), Vector3(2.5, -0.35, 0)));
+
+	// Moves past the wall in a single step.
+	RID body = ps->body_create();
+	ps->body_add_shape(body, box_shape);
+	ps->body_set_space(body, space);
+	ps->body_set_enable_continuous_collision_detection(body, true);
+	ps->body_set_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(240, 0, 0));
+
+	ps->step(STEP_TIME);
+	ps->flush_queries();
+
+	Transform xform = ps->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM);
+	CHECK_MESSAGE(xform.origin.x < 2.05, "The body should not go through the wall.");
+
+	ps->free(body);
+	ps->free(wall);
+	ps->free(box_shape);
+	ps->free(wall_shape);
+	ps->free(space);
+	ps->finish();
+	memdelete(ps);
+}
+
+TEST_CASE("[PhysicsServer2D] Continuous collision detection stops fast rotating bodies before thin walls") {
+	PhysicsServer2DSW *ps = memnew(PhysicsServer2DSW);
+	ps->init();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	ps->area_set_param(space, PhysicsServer2D::AREA_PARAM_GRAVITY, 0.0);
+
+	RID wall_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(wall_shape, Vector2(1, 7));
+	RID bar_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(bar_shape, Vector2(40, 2));
+
+	// Neither touches the bar before nor after its rotation in the step, only in between.
+	RID wall = ps->body_create();
+	ps->body_set_mode(wall, PhysicsServer2D::BODY_MODE_STATIC);
+	ps->body_add_shape(wall, wall_shape);
+	ps->body_set_space(wall, space);
+	ps->body_set_state(wall, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, Vector2(30, 13)));
+
+	RID body = ps->body_create();
+	ps->body_add_shape(body, bar_shape);
+	ps->body_set_space(body, space);
+	ps->body_set_continuous_collision_detection_mode(body, PhysicsServer2D::CCD_MODE_CAST_SHAPE);
+	ps->body_set_state(body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, 60.0);
+
+	ps->step(STEP_TIME);
+	ps->flush_queries();
+
+	Transform2D xform = ps->body_get_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM);
+	CHECK_MESSAGE(xform.get_rotation() < 0.6, "The body should not rotate through the wall.");
+	// Stopping the rotation moves the body, but only through its velocity, the contacts shouldn't push it out of the wall.
+	Vector2 linear_velocity = ps->body_get_state(body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY);
+	CHECK_MESSAGE(xform.get_origin().distance_to(linear_velocity * STEP_TIME) < 0.01, "The contacts should not push the body away from where it moves.");
+
+	ps->free(body);
+	ps->free(wall);
+	ps->free(bar_shape);
+	ps->free(wall_shape);
+	ps->free(space);
+	ps->finish();
+	memdelete(ps);
+}
+
+// Receives the body states sent by the physics servers when flushing queries.
+class BodyStateReceiver : public Object {
+	GDCLASS(BodyStateReceiver, Object);
+
+public:
+	int state_count = 0;
+	Variant transform;
+
+	void _state_changed_3d(Object *p_state) {
+		state_count++;
+		transform = Object::cast_to<PhysicsDirectBodyState3D>(p_state)->get_transform();
+	}
+
+	void _state_changed_2d(Object *p_state) {
+		state_count++;
+		transform = Object::cast_to<PhysicsDirectBodyState2D>(p_state)->get_transform();
+	}
+};
+
+// Steps like the main loop does, sending the body states after each step.
+template <class T>
+static void _step(T *p_server, int p_step_count) {
+	for (int i = 0; i < p_step_count; i++) {
+		p_server->step(STEP_TIME);
+		p_server->flush_queries();
+	}
+}
+
+template <class T>
+static Array _get_body_states(T *p_server, const Vector<RID> &p_bodies) {
+	Array states;
+	for (int i = 0; i < p_bodies.size(); i++) {
+		states.push_back(p_server->body_get_state(p_bodies[i], T::BODY_STATE_TRANSFORM));
+		states.push_back(p_server->body_get_state(p_bodies[i], T::BODY_STATE_LINEAR_VELOCITY));
+		states.push_back(p_server->body_get_state(p_bodies[i], T::BODY_STATE_ANGULAR_VELOCITY));
+	}
+	return states;
+}
+
+TEST_CASE("[PhysicsServer3D] Restoring a snapshot replays the same steps") {
+	PhysicsServer3DSW *ps = memnew(PhysicsServer3DSW);
+	ps->init();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	ps->space_set_deterministic(space, true);
+	ps->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY, 9.8);
+	ps->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY_VECTOR, Vector3(0, -1, 0));
+
+	RID floor_shape = ps->box_shape_create();
+	ps->shape_set_data(floor_shape, Vector3(10, 1, 10));
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+	RID sphere_shape = ps->sphere_shape_create();
+	ps->shape_set_data(sphere_shape, 0.5);
+
+	RID floor = ps->body_create();
+	ps->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	ps->body_add_shape(floor, floor_shape);
+	ps->body_set_space(floor, space);
+	ps->body_set_state(floor, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform(Basis(), Vector3(0, -1, 0)));
+
+	// A stack that falls over, with a joint.
+	Vector<RID> bodies;
+	for (int i = 0; i < 12; i++) {
+		RID body = ps->body_create();
+		ps->body_add_shape(body, i % 4 == 3 ? sphere_shape : box_shape);
+		ps->body_set_space(body, space);
+		ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform(Basis(Vector3(0, 1, 0), i * 0.1), Vector3((i % 3) * 0.3, 0.5 + i * 1.05, (i % 2) * 0.2)));
+		bodies.push_back(body);
+	}
+	RID joint = ps->joint_create();
+	ps->joint_make_pin(joint, bodies[0], Vector3(0, 0.5, 0), bodies[1], Vector3(0, -0.5, 0));
+
+	BodyStateReceiver *receiver = memnew(BodyStateReceiver);
+	ps->body_set_force_integration_callback(bodies[5], callable_mp(receiver, &BodyStateReceiver::_state_changed_3d));
+
+	_step(ps, 60);
+
+	Vector<uint8_t> snapshot = ps->space_save_snapshot(space);
+	REQUIRE(snapshot.size() > 0);
+	Transform saved_transform = ps->body_get_state(bodies[5], PhysicsServer3D::BODY_STATE_TRANSFORM);
+
+	_step(ps, 60);
+	Array first_run = _get_body_states(ps, bodies);
+
+	CHECK(ps->space_restore_snapshot(space, snapshot) == OK);
+
+	// The restored bodies report their state, even before stepping again.
+	int state_count = receiver->state_count;
+	ps->flush_queries();
+	CHECK(receiver->state_count == state_count + 1);
+	CHECK(Transform(receiver->transform) == saved_transform);
+
+	_step(ps, 60);
+	Array second_run = _get_body_states(ps, bodies);
+
+	CHECK_MESSAGE(Variant(first_run).hash_compare(second_run), "Transforms and velocities should be the same after restoring the snapshot.");
+
+	ps->free(joint);
+	for (int i = 0; i < bodies.size(); i++) {
+		ps->free(bodies[i]);
+	}
+	ps->free(floor);
+	ps->free(sphere_shape);
+	ps->free(box_shape);
+	ps->free(floor_shape);
+	ps->free(space);
+	ps->finish();
+	memdelete(ps);
+	memdelete(receiver);
+}
+
+TEST_CASE("[PhysicsServer2D] Restoring a snapshot replays the same steps") {
+	PhysicsServer2DSW *ps = memnew(PhysicsServer2DSW);
+	ps->init();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	ps->space_set_deterministic(space, true);
+	ps->area_set_param(space, PhysicsServer2D::AREA_PARAM_GRAVITY, 98.0);
+	ps->area_set_param(space, PhysicsServer2D::AREA_PARAM_GRAVITY_VECTOR, Vector2(0, 1));
+
+	RID floor_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(floor_shape, Vector2(200, 10));
+	RID rectangle_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(rectangle_shape, Vector2(10, 10));
+	RID circle_shape = ps->circle_shape_create();
+	ps->shape_set_data(circle_shape, 10);
+
+	RID floor = ps->body_create();
+	ps->body_set_mode(floor, PhysicsServer2D::BODY_MODE_STATIC);
+	ps->body_add_shape(floor, floor_shape);
+	ps->body_set_space(floor, space);
+	ps->body_set_state(floor, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, Vector2(0, 10)));
+
+	// A stack that falls over, with a joint.
+	Vector<RID> bodies;
+	for (int i = 0; i < 12; i++) {
+		RID body = ps->body_create();
+		ps->body_add_shape(body, i % 4 == 3 ? circle_shape : rectangle_shape);
+		ps->body_set_space(body, space);
+		ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(i * 0.05, Vector2((i % 3) * 3, -10 - i * 21)));
+		bodies.push_back(body);
+	}
+	RID joint = ps->joint_create();
+	ps->joint_make_pin(joint, Vector2(0, -20), bodies[0], bodies[1]);
+
+	BodyStateReceiver *receiver = memnew(BodyStateReceiver);
+	ps->body_set_force_integration_callback(bodies[5], callable_mp(receiver, &BodyStateReceiver::_state_changed_2d));
+
+	_step(ps, 60);
+
+	Vector<uint8_t> snapshot = ps->space_save_snapshot(space);
+	REQUIRE(snapshot.size() > 0);
+	Transform2D saved_transform = ps->body_get_state(bodies[5], PhysicsServer2D::BODY_STATE_TRANSFORM);
+
+	_step(ps, 60);
+	Array first_run = _get_body_states(ps, bodies);
+
+	CHECK(ps->space_restore_snapshot(space, snapshot) == OK);
+
+	// The restored bodies report their state, even before stepping again.
+	int state_count = receiver->state_count;
+	ps->flush_queries();
+	CHECK(receiver->state_count == state_count + 1);
+	CHECK(Transform2D(receiver->transform) == saved_transform);
+
+	_step(ps, 60);
+	Array second_run = _get_body_states(ps, bodies);
+
+	CHECK_MESSAGE(Variant(first_run).hash_compare(second_run), "Transforms and velocities should be the same after restoring the snapshot.");
+
+	ps->free(joint);
+	for (int i = 0; i < bodies.size(); i++) {
+		ps->free(bodies[i]);
+	}
+	ps->free(floor);
+	ps->free(circle_shape);
+	ps->free(rectangle_shape);
+	ps->free(floor_shape);
+	ps->free(space);
+	ps->finish();
+	memdelete(ps);
+	memdelete(receiver);
+}
+
+} // namespace TestPhysicsServer
+
+#endif // TEST_PHYSICS_SERVER_H
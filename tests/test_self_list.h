@@ -0,0 +1,86 @@
+/*************************************************************************/
+/*  test_self_list.h                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_SELF_LIST_H
+#define TEST_SELF_LIST_H
+
+#include "core/templates/self_list.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSelfList {
+
+struct SelfListItem {
+	int key = 0;
+	int order = 0;
+	SelfList<SelfListItem> self;
+
+	SelfListItem() :
+			self(this) {}
+};
+
+struct SelfListItemComparator {
+	bool operator()(const SelfListItem *p_a, const SelfListItem *p_b) const {
+		return p_a->key < p_b->key;
+	}
+};
+
+TEST_CASE("[SelfList] Sort custom") {
+	const int count = 37;
+	SelfList<SelfListItem>::List list;
+	SelfListItem items[count];
+	for (int i = 0; i < count; i++) {
+		items[i].key = (i * 7) % 5;
+		items[i].order = i;
+		list.add_last(&items[i].self);
+	}
+
+	list.sort_custom<SelfListItemComparator>();
+
+	int visited = 0;
+	const SelfList<SelfListItem> *prev = nullptr;
+	for (const SelfList<SelfListItem> *E = list.first(); E; E = E->next()) {
+		CHECK(E->prev() == prev);
+		if (prev) {
+			CHECK(prev->self()->key <= E->self()->key);
+			if (prev->self()->key == E->self()->key) {
+				// Sorting is stable.
+				CHECK(prev->self()->order < E->self()->order);
+			}
+		}
+		prev = E;
+		visited++;
+	}
+	CHECK(visited == count);
+}
+
+} // namespace TestSelfList
+
+#endif // TEST_SELF_LIST_H
@@ -184,6 +184,51 @@ TEST_CASE("[String] Invalid UTF16") {
 	ERR_PRINT_ON
 }
 
+TEST_CASE("[String] UTF8 and UTF16 with long ASCII runs") {
+	// Exercise the bulk ASCII paths with non-ASCII characters at every position around the vector widths.
+	for (int len = 1; len < 40; len++) {
+		for (int pos = -1; pos < len; pos++) {
+			String s;
+			for (int i = 0; i < len; i++) {
+				s += (i == pos) ? char32_t(0x1F3A4) : char32_t('a' + i % 26);
+			}
+
+			CharString cs = s.utf8();
+			CHECK(cs.length() == (pos < 0 ? len : len + 3));
+			String t;
+			CHECK(!t.parse_utf8(cs.get_data()));
+			CHECK(t == s);
+			CHECK(!t.parse_utf8(cs.get_data(), cs.length()));
+			CHECK(t == s);
+
+			Char16String cs16 = s.utf16();
+			CHECK(cs16.length() == (pos < 0 ? len : len + 1));
+			CHECK(!t.parse_utf16(cs16.get_data()));
+			CHECK(t == s);
+			CHECK(!t.parse_utf16(cs16.get_data(), cs16.length()));
+			CHECK(t == s);
+		}
+	}
+
+	// An embedded NUL stops UTF-8 parsing even when a length is given.
+	static const char u8str[] = { 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 0, 's', 't' };
+	String s;
+	CHECK(!s.parse_utf8(u8str, sizeof(u8str)));
+	CHECK(s == "abcdefghijklmnopqr");
+}
+
+TEST_CASE("[String] Find in long strings") {
+	String s = "abcdefghijklmnopqrstuvwxyz0123456789 needle abcdefghijklmnopqrstuvwxyz needle";
+	CHECK(s.find("needle") == 37);
+	CHECK(s.find(String("needle")) == 37);
+	CHECK(s.find("needle", 38) == 71);
+	CHECK(s.find(String("needle"), 38) == 71);
+	CHECK(s.find("needles") == -1);
+	CHECK(s.find(String("needles")) == -1);
+	CHECK(s.find("e", 74) == 76);
+	CHECK(s.find("le", 76) == -1);
+}
+
 TEST_CASE("[String] ASCII") {
 	String s = U"Primero Leche";
 	String t = s.ascii(false).get_data();
@@ -231,6 +276,28 @@ TEST_CASE("[String] Concatenation") {
 	CHECK(s == "Have a Nice Day");
 }
 
+TEST_CASE("[String] Concatenation of shared strings") {
+	String a = "Have a";
+	String b = a;
+
+	b += " Nice";
+	CHECK(a == "Have a");
+	CHECK(b == "Have a Nice");
+
+	String c = b + String(" Day");
+	CHECK(b == "Have a Nice");
+	CHECK(c == "Have a Nice Day");
+
+	String d = c;
+	d += U'!';
+	CHECK(c == "Have a Nice Day");
+	CHECK(d == "Have a Nice Day!");
+	CHECK(d.length() == 16);
+
+	CHECK(String() + a == a);
+	CHECK(a + String() == a);
+}
+
 TEST_CASE("[String] Testing size and length of string") {
 	// todo: expand this test to do more tests on size() as it is complicated under the hood.
 	CHECK(String("Mellon").size() == 7);
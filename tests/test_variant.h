@@ -31,6 +31,9 @@
 #ifndef TEST_VARIANT_H
 #define TEST_VARIANT_H
 
+#include "core/os/dir_access.h"
+#include "core/os/file_access.h"
+#include "core/os/os.h"
 #include "core/variant/variant.h"
 #include "core/variant/variant_parser.h"
 
@@ -106,6 +109,118 @@ TEST_CASE("[Variant] Writer and parser float") {
 	CHECK_MESSAGE(b64_float_parsed == 340282001837565597733306976381245063168.0, "Should not overflow.");
 }
 
+TEST_CASE("[Variant] Writer and parser packed arrays") {
+	PackedVector3Array vectors;
+	PackedFloat32Array floats;
+	PackedInt32Array ints;
+	for (int i = 0; i < 3000; i++) {
+		vectors.push_back(Vector3(i, -i * 0.5, i * 1e-3));
+		floats.push_back(i * 0.25);
+		ints.push_back(i - 1500);
+	}
+
+	Array array;
+	array.push_back(vectors);
+	array.push_back(floats);
+	array.push_back(ints);
+	array.push_back(PackedByteArray());
+	array.push_back(String::utf8("\xc3\xa9t\xc3\xa9 \\ \"quoted\""));
+
+	String array_str;
+	VariantWriter::write_to_string(array, array_str);
+
+	VariantParser::StreamString ss;
+	ss.s = array_str;
+	String errs;
+	int line = 1;
+	Variant parsed;
+	REQUIRE(VariantParser::parse(&ss, parsed, errs, line) == OK);
+
+	const Array parsed_array = parsed;
+	REQUIRE(parsed_array.size() == 5);
+	const PackedVector3Array parsed_vectors = parsed_array[0];
+	const PackedFloat32Array parsed_floats = parsed_array[1];
+	const PackedInt32Array parsed_ints = parsed_array[2];
+	CHECK(parsed_vectors.size() == 3000);
+	CHECK(parsed_vectors[2999].is_equal_approx(vectors[2999]));
+	CHECK(parsed_floats == floats);
+	CHECK(parsed_ints == ints);
+	CHECK(PackedByteArray(parsed_array[3]).size() == 0);
+	CHECK(parsed_array[4] == array[4]);
+
+	ss = VariantParser::StreamString();
+	ss.s = "PackedFloat32Array(1, 2,)";
+	CHECK_MESSAGE(VariantParser::parse(&ss, parsed, errs, line) == ERR_PARSE_ERROR, "Trailing commas are not allowed in constructors.");
+
+	ss = VariantParser::StreamString();
+	ss.s = "PackedFloat32Array(1-2, 3)";
+	CHECK_MESSAGE(VariantParser::parse(&ss, parsed, errs, line) == ERR_PARSE_ERROR, "Malformed numbers are not allowed in constructors.");
+
+	const char *missing_digits[] = { "PackedFloat32Array(1, -)", "PackedFloat32Array(1e, 2)", "PackedFloat32Array(-.)", "PackedInt32Array(-, 1)" };
+	for (const char *text : missing_digits) {
+		ss = VariantParser::StreamString();
+		ss.s = text;
+		CHECK_MESSAGE(VariantParser::parse(&ss, parsed, errs, line) == ERR_PARSE_ERROR, "Numbers without digits in the mantissa or the exponent are not allowed in constructors.");
+	}
+
+	ss = VariantParser::StreamString();
+	ss.s = "PackedFloat32Array(-1.5e-2, 2e+3, 4.)";
+	REQUIRE(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	const PackedFloat32Array exponents = parsed;
+	REQUIRE(exponents.size() == 3);
+	CHECK(exponents[0] == doctest::Approx(-0.015));
+	CHECK(exponents[1] == doctest::Approx(2000.0));
+	CHECK(exponents[2] == doctest::Approx(4.0));
+}
+
+TEST_CASE("[Variant] Parser from a file") {
+	// Large enough to span several read ahead buffers, with escapes that only decode correctly from UTF-8.
+	Array array;
+	PackedVector2Array vectors;
+	for (int i = 0; i < 1000; i++) {
+		vectors.push_back(Vector2(i, -i * 0.5));
+	}
+	array.push_back(vectors);
+	array.push_back(String::utf8("\xc3\xa9t\xc3\xa9"));
+
+	String array_str;
+	VariantWriter::write_to_string(array, array_str);
+	// A surrogate pair escape and a non ASCII escape, as other tools write them.
+	array_str = array_str.substr(0, array_str.rfind("]")) + ", \"\\uD83D\\uDE00 \\u00e9\" ]";
+
+	const String path = OS::get_singleton()->get_cache_path().plus_file("test_variant_parser.tres");
+	{
+		FileAccessRef f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f);
+		f->store_string(array_str);
+	}
+
+	FileAccessRef f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(f);
+	VariantParser::StreamFile sf;
+	sf.f = f;
+	String errs;
+	int line = 1;
+	Variant parsed_file;
+	REQUIRE(VariantParser::parse(&sf, parsed_file, errs, line) == OK);
+
+	VariantParser::StreamString ss;
+	ss.s = array_str;
+	Variant parsed_string;
+	REQUIRE(VariantParser::parse(&ss, parsed_string, errs, line) == OK);
+
+	const Array file_array = parsed_file;
+	REQUIRE(file_array.size() == 3);
+	CHECK(PackedVector2Array(file_array[0]) == vectors);
+	CHECK(file_array[1] == array[1]);
+	const String expected = String::utf8("\xf0\x9f\x98\x80 \xc3\xa9");
+	CHECK_MESSAGE(file_array[2] == expected, "Surrogate pairs should be decoded into a single character from files.");
+	CHECK_MESSAGE(parsed_string.hash_compare(parsed_file), "Parsing from a file and from a string should give the same result.");
+
+	f->close();
+	DirAccess::remove_file_or_error(path);
+}
+
 TEST_CASE("[Variant] Assignment To Bool from Int,Float,String,Vec2,Vec2i,Vec3,Vec3i and Color") {
 	Variant int_v = 0;
 	Variant bool_v = true;
@@ -159,6 +159,32 @@ TEST_CASE("[Vector] Copy creation") {
 	CHECK(vector[4] == 4);
 }
 
+TEST_CASE("[Vector] Resize shared copy") {
+	Vector<String> vector;
+	vector.push_back("0");
+	vector.push_back("1");
+	vector.push_back("2");
+
+	Vector<String> grown = vector;
+	grown.resize(5);
+	grown.write[4] = "4";
+	CHECK(grown.size() == 5);
+	CHECK(grown[2] == "2");
+	CHECK(grown[3] == String());
+	CHECK(grown[4] == "4");
+
+	Vector<String> shrunk = vector;
+	shrunk.resize(1);
+	CHECK(shrunk.size() == 1);
+	CHECK(shrunk[0] == "0");
+
+	// Make sure the original vector isn't modified.
+	CHECK(vector.size() == 3);
+	CHECK(vector[0] == "0");
+	CHECK(vector[1] == "1");
+	CHECK(vector[2] == "2");
+}
+
 TEST_CASE("[Vector] Duplicate") {
 	Vector<int> vector;
 	vector.push_back(0);